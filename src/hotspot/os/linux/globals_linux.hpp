@@ -50,6 +50,12 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, THPCollapseOnCommit, false, EXPERIMENTAL,               \
+          "With UseTransparentHugePages, populate committed large-page "\
+          "aligned memory with MADV_POPULATE_WRITE and collapse it "    \
+          "with MADV_COLLAPSE (Linux 6.1 and later), so it is backed "  \
+          "by huge pages right away instead of waiting for khugepaged") \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
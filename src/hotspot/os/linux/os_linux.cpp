@@ -2810,6 +2810,16 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE 25
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2841,6 +2851,18 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
     // We don't check the return value: madvise(MADV_HUGEPAGE) may not
     // be supported or the memory may already be backed by huge pages.
     ::madvise(addr, bytes, MADV_HUGEPAGE);
+    if (THPCollapseOnCommit) {
+      // MADV_COLLAPSE only collapses pages that are already populated, so
+      // populate the fully covered huge pages first and then collapse
+      // whatever has been faulted in as small pages. Failures (EINVAL on
+      // kernels without MADV_POPULATE_WRITE or MADV_COLLAPSE, or EAGAIN
+      // when no huge page is available) leave the range to khugepaged.
+      char* start = align_up(addr, os::large_page_size());
+      char* end = align_down(addr + bytes, os::large_page_size());
+      if (start < end && ::madvise(start, end - start, MADV_POPULATE_WRITE) == 0) {
+        ::madvise(start, end - start, MADV_COLLAPSE);
+      }
+    }
   }
 }
 
@@ -482,6 +482,11 @@ void Compilation::compile_method() {
     install_code(frame_size);
   }
 
+  // Capture slow compilations so they can be replayed and analyzed offline.
+  if (!bailed_out() && !_directive->DumpReplayOption && env()->exceeds_replay_compile_time_threshold()) {
+    env()->dump_replay_data(env()->compile_id());
+  }
+
   if (log() != nullptr) // Print code cache state into compiler log
     log()->code_cache_state();
 
@@ -1451,6 +1451,13 @@ int interval_cmp(Interval* const& l, Interval* const& r) {
   return l->from() - r->from();
 }
 
+// Orders by from() and then by reg_num, which is the position in _intervals;
+// this is the order the insertion sort in sort_intervals_before_allocation produces.
+static int interval_cmp_from_reg_num(Interval** a, Interval** b) {
+  int diff = (*a)->from() - (*b)->from();
+  return diff != 0 ? diff : (*a)->reg_num() - (*b)->reg_num();
+}
+
 bool find_interval(Interval* interval, IntervalArray* intervals) {
   bool found;
   int idx = intervals->find_sorted<Interval*, interval_cmp>(interval, found);
@@ -1574,6 +1581,7 @@ void LinearScan::sort_intervals_before_allocation() {
   int unsorted_idx;
   int sorted_idx = 0;
   int sorted_from_max = -1;
+  int moved = 0;
 
   // calc number of items for sorted list (sorted list must not contain null values)
   for (unsorted_idx = 0; unsorted_idx < unsorted_len; unsorted_idx++) {
@@ -1602,7 +1610,20 @@ void LinearScan::sort_intervals_before_allocation() {
           sorted_list->at_put(j + 1, sorted_list->at(j));
         }
         sorted_list->at_put(j + 1, cur_interval);
+        moved += sorted_idx - 1 - j;
         sorted_idx++;
+
+        if (moved > 8 * sorted_len) {
+          // the list is far from sorted and the insertion sort degrades towards
+          // quadratic time, so finish with a full sort that yields the same order
+          for (unsorted_idx++; unsorted_idx < unsorted_len; unsorted_idx++) {
+            if (unsorted_list->at(unsorted_idx) != nullptr) {
+              sorted_list->at_put(sorted_idx++, unsorted_list->at(unsorted_idx));
+            }
+          }
+          sorted_list->sort(interval_cmp_from_reg_num);
+          break;
+        }
       }
     }
   }
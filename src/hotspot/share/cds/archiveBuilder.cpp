@@ -35,18 +35,22 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/compressedKlass.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/sharedRuntime.hpp"
@@ -536,9 +540,11 @@ ArchiveBuilder::FollowMode ArchiveBuilder::get_follow_mode(MetaspaceClosure::Ref
   if (MetaspaceShared::is_in_shared_metaspace(obj)) {
     // Don't dump existing shared metadata again.
     return point_to_it;
-  } else if (ref->msotype() == MetaspaceObj::MethodDataType ||
-             ref->msotype() == MetaspaceObj::MethodCountersType) {
+  } else if (ref->msotype() == MetaspaceObj::MethodDataType) {
     return set_to_null;
+  } else if (ref->msotype() == MetaspaceObj::MethodCountersType) {
+    // The counters of a training run can be kept in the dynamic archive.
+    return (DynamicDumpSharedSpaces && ArchiveMethodCounters) ? make_a_copy : set_to_null;
   } else {
     if (ref->msotype() == MetaspaceObj::ClassType) {
       Klass* klass = (Klass*)ref->obj();
@@ -692,7 +698,49 @@ address ArchiveBuilder::get_source_addr(address buffered_addr) const {
   return *src_p;
 }
 
+// Relocates the pointers of the objects in a SourceObjList in parallel. Each
+// object is only written through its own buffered copy, and the lookups in
+// _src_obj_table do not modify it.
+class RelocateEmbeddedPointersTask : public WorkerTask {
+  // Number of objects claimed by a worker at a time.
+  static const int ChunkSize = 256;
+
+  ArchiveBuilder* _builder;
+  ArchiveBuilder::SourceObjList* _src_objs;
+  volatile int _next;
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, ArchiveBuilder::SourceObjList* src_objs) :
+    WorkerTask("RelocateEmbeddedPointers"),
+    _builder(builder),
+    _src_objs(src_objs),
+    _next(0) {}
+
+  static bool should_run_in_parallel(ArchiveBuilder::SourceObjList* src_objs) {
+    return src_objs->objs()->length() > ChunkSize;
+  }
+
+  void work(uint worker_id) override {
+    const int len = _src_objs->objs()->length();
+    for (int beg = Atomic::fetch_then_add(&_next, ChunkSize);
+         beg < len;
+         beg = Atomic::fetch_then_add(&_next, ChunkSize)) {
+      const int end = MIN2(beg + ChunkSize, len);
+      for (int i = beg; i < end; i++) {
+        _src_objs->relocate(i, _builder);
+      }
+    }
+  }
+};
+
 void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr && workers->active_workers() > 1 &&
+      RelocateEmbeddedPointersTask::should_run_in_parallel(src_objs)) {
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    workers->run_task(&task);
+    return;
+  }
   for (int i = 0; i < src_objs->objs()->length(); i++) {
     src_objs->relocate(i, this);
   }
@@ -700,6 +748,9 @@ void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* s
 
 void ArchiveBuilder::relocate_metaspaceobj_embedded_pointers() {
   log_info(cds)("Relocating embedded pointers in core regions ... ");
+  // All objects have been copied, so no more buffer space is committed while
+  // the pointers are relocated.
+  ArchivePtrMarker::prepare_for_parallel_marking();
   relocate_embedded_pointers(&_rw_src_objs);
   relocate_embedded_pointers(&_ro_src_objs);
 }
@@ -195,6 +195,7 @@ private:
   };
 
   class CDSMapLogger;
+  friend class RelocateEmbeddedPointersTask;
 
   static const int INITIAL_TABLE_SIZE = 15889;
   static const int MAX_TABLE_SIZE     = 1000000;
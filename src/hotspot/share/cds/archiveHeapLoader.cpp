@@ -259,6 +259,35 @@ class ArchiveHeapLoader::PatchLoadedRegionPointers: public BitMapClosure {
   }
 };
 
+// Same as PatchLoadedRegionPointers, for the case that the dumptime and runtime
+// narrowOop shifts are the same: the runtime narrowOop is then the dumptime
+// narrowOop plus a constant.
+class ArchiveHeapLoader::PatchLoadedRegionPointersQuick: public BitMapClosure {
+  narrowOop* _start;
+  uint32_t _delta;
+  DEBUG_ONLY(intx _offset;)
+
+ public:
+  PatchLoadedRegionPointersQuick(narrowOop* start, LoadedArchiveHeapRegion* loaded_region, uint32_t delta)
+    : _start(start),
+      _delta(delta)
+      DEBUG_ONLY(COMMA _offset(loaded_region->_runtime_offset)) {}
+
+  bool do_bit(size_t offset) {
+    narrowOop* p = _start + offset;
+    narrowOop v = *p;
+    assert(!CompressedOops::is_null(v), "null oops should have been filtered out at dump time");
+    narrowOop new_v = CompressedOops::narrow_oop_cast(CompressedOops::narrow_oop_value(v) + _delta);
+#ifdef ASSERT
+    uintptr_t o = cast_from_oop<uintptr_t>(ArchiveHeapLoader::decode_from_archive(v)) + _offset;
+    ArchiveHeapLoader::assert_in_loaded_heap(o);
+    assert(cast_to_oop(o) == CompressedOops::decode_not_null(new_v), "quick delta must work");
+#endif
+    RawAccess<IS_NOT_NULL>::oop_store(p, new_v);
+    return true;
+  }
+};
+
 bool ArchiveHeapLoader::init_loaded_region(FileMapInfo* mapinfo, LoadedArchiveHeapRegion* loaded_region,
                                            MemRegion& archive_space) {
   size_t total_bytes = 0;
@@ -315,8 +344,19 @@ bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiv
   uintptr_t oopmap = bitmap_base + r->oopmap_offset();
   BitMapView bm((BitMap::bm_word_t*)oopmap, r->oopmap_size_in_bits());
 
-  PatchLoadedRegionPointers patcher((narrowOop*)load_address, loaded_region);
-  bm.iterate(&patcher);
+  if (_narrow_oop_shift == CompressedOops::shift()) {
+    uintptr_t dt_encoded_bottom = (loaded_region->_dumptime_base - (uintptr_t)_narrow_oop_base) >> _narrow_oop_shift;
+    narrowOop rt_encoded_bottom = CompressedOops::encode_not_null(cast_to_oop(load_address));
+    uint32_t quick_delta = (uint32_t)rt_encoded_bottom - (uint32_t)dt_encoded_bottom;
+    log_info(cds)("CDS heap data relocation quick delta = 0x%x", quick_delta);
+    if (quick_delta != 0) {
+      PatchLoadedRegionPointersQuick patcher((narrowOop*)load_address, loaded_region, quick_delta);
+      bm.iterate(&patcher);
+    }
+  } else {
+    PatchLoadedRegionPointers patcher((narrowOop*)load_address, loaded_region);
+    bm.iterate(&patcher);
+  }
   return true;
 }
 
@@ -85,12 +85,21 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
         _ptrmap->resize((idx + 1) * 2);
       }
       assert(idx < _ptrmap->size(), "must be");
-      _ptrmap->set_bit(idx);
+      _ptrmap->par_set_bit(idx);
       //tty->print_cr("Marking pointer [" PTR_FORMAT "] -> " PTR_FORMAT " @ " SIZE_FORMAT_W(5), p2i(ptr_loc), p2i(*ptr_loc), idx);
     }
   }
 }
 
+void ArchivePtrMarker::prepare_for_parallel_marking() {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  size_t bits = ptr_end() - ptr_base();
+  if (_ptrmap->size() < bits) {
+    _ptrmap->resize(bits);
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != nullptr, "not initialized");
   assert(!_compacted, "cannot clear anymore");
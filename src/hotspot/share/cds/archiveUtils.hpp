@@ -55,6 +55,9 @@ public:
   static void initialize(CHeapBitMap* ptrmap, VirtualSpace* vs);
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
+  // Size the bitmap for all of the committed space, so that several threads can
+  // mark pointers at the same time as long as no more space is committed.
+  static void prepare_for_parallel_marking();
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "cds/archivedClassPreloader.hpp"
+#include "cds/cds_globals.hpp"
+#include "classfile/javaClasses.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "classfile/systemDictionaryShared.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "utilities/formatBuffer.hpp"
+
+GrowableArray<InstanceKlass*>* ArchivedClassPreloadThread::_classes = nullptr;
+volatile int ArchivedClassPreloadThread::_next = 0;
+volatile int ArchivedClassPreloadThread::_loaded = 0;
+volatile uint ArchivedClassPreloadThread::_running = 0;
+jlong ArchivedClassPreloadThread::_start_ticks = 0;
+
+void ArchivedClassPreloadThread::initialize() {
+  assert(ArchivedClassPreloadThreads > 0, "must be enabled");
+  if (!UseSharedSpaces) {
+    return;
+  }
+
+  _classes = new (mtClass) GrowableArray<InstanceKlass*>(1024, mtClass);
+  SystemDictionaryShared::collect_shared_boot_classes(_classes);
+  if (_classes->is_empty()) {
+    delete _classes;
+    _classes = nullptr;
+    return;
+  }
+
+  log_info(cds)("Preloading %d archived boot classes with %u threads",
+                _classes->length(), ArchivedClassPreloadThreads);
+  _start_ticks = os::elapsed_counter();
+  _running = ArchivedClassPreloadThreads;
+
+  EXCEPTION_MARK;
+  for (uint i = 0; i < ArchivedClassPreloadThreads; i++) {
+    FormatBuffer<> name("Archived Class Preload Thread #%u", i);
+    Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+
+    ArchivedClassPreloadThread* thread = new ArchivedClassPreloadThread(&preload_thread_entry);
+    if (thread->osthread() == nullptr) {
+      // Preloading is only an optimization, so simply run with fewer threads.
+      // The new thread is not known to Thread-SMR yet so we can just delete.
+      delete thread;
+      if (Atomic::sub(&_running, 1u) == 0) {
+        delete _classes;
+        _classes = nullptr;
+      }
+      continue;
+    }
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  }
+}
+
+void ArchivedClassPreloadThread::preload_class(InstanceKlass* ik, TRAPS) {
+  if (ik->is_loaded()) {
+    // Already loaded on demand by another thread.
+    return;
+  }
+
+  // The boot loader loads the super types first, and the placeholder table
+  // makes concurrent requests for the same class wait for the first one.
+  Klass* k = SystemDictionary::resolve_or_null(ik->name(), Handle(), Handle(), CHECK);
+  if (k != ik) {
+    // The archived class was not usable, e.g. because it is not visible in
+    // the runtime module graph. Leave it to the on-demand path.
+    return;
+  }
+  ik->link_class(CHECK);
+  Atomic::inc(&_loaded);
+}
+
+void ArchivedClassPreloadThread::preload_thread_entry(JavaThread* jt, TRAPS) {
+  const int length = _classes->length();
+  while (true) {
+    int i = Atomic::fetch_then_add(&_next, 1);
+    if (i >= length) {
+      break;
+    }
+    HandleMark hm(THREAD);
+    InstanceKlass* ik = _classes->at(i);
+    preload_class(ik, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      // Any error is reported again when the class is requested by the application.
+      if (log_is_enabled(Debug, cds)) {
+        ResourceMark rm(THREAD);
+        log_debug(cds)("Preloading %s failed: %s", ik->external_name(),
+                       PENDING_EXCEPTION->klass()->external_name());
+      }
+      CLEAR_PENDING_EXCEPTION;
+    }
+  }
+
+  if (Atomic::sub(&_running, 1u) == 0) {
+    log_info(cds)("Preloaded %d of %d archived boot classes in %.3f ms",
+                  Atomic::load(&_loaded), length,
+                  (double)(os::elapsed_counter() - _start_ticks) * 1000.0 / os::elapsed_frequency());
+    delete _classes;
+    _classes = nullptr;
+  }
+}
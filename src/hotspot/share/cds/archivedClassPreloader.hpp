@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CDS_ARCHIVEDCLASSPRELOADER_HPP
+#define SHARE_CDS_ARCHIVEDCLASSPRELOADER_HPP
+
+#include "runtime/javaThread.hpp"
+#include "utilities/growableArray.hpp"
+
+class InstanceKlass;
+
+// Hidden JavaThreads that load and link the archived classes of the boot
+// loader in the background during startup, so that the main thread finds
+// them already restored when it first uses them. The threads claim classes
+// from a shared list; SystemDictionary loads the super types of a class
+// before the class itself, so the dependency order is preserved even when
+// several threads work on the same hierarchy.
+class ArchivedClassPreloadThread : public JavaThread {
+  friend class VMStructs;
+ private:
+  static GrowableArray<InstanceKlass*>* _classes;
+  static volatile int _next;
+  static volatile int _loaded;
+  static volatile uint _running;
+  static jlong _start_ticks;
+
+  static void preload_thread_entry(JavaThread* thread, TRAPS);
+  static void preload_class(InstanceKlass* ik, TRAPS);
+  ArchivedClassPreloadThread(ThreadFunction entry_point) : JavaThread(entry_point) {};
+
+ public:
+  static void initialize();
+
+  // Hide this thread from external view.
+  bool is_hidden_from_external_view() const { return true; }
+};
+
+#endif // SHARE_CDS_ARCHIVEDCLASSPRELOADER_HPP
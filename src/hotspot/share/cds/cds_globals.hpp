@@ -49,6 +49,20 @@
   product(bool, AutoCreateSharedArchive, false,                             \
           "Create shared archive at exit if cds mapping failed")            \
                                                                             \
+  product(bool, UseArchivedCompilationHints, false, EXPERIMENTAL,           \
+          "Compile methods that had C2 code when the dynamic archive was "  \
+          "dumped without waiting for the interpreter thresholds")          \
+                                                                            \
+  product(bool, ArchiveMethodCounters, false, EXPERIMENTAL,                 \
+          "Store the invocation and backedge counters of the methods in "   \
+          "the dynamic archive, so that the compilation policy starts "     \
+          "from the counts of the training run")                            \
+                                                                            \
+  product(uint, ArchivedClassPreloadThreads, 0, EXPERIMENTAL,               \
+          "Number of background threads that load and link the archived "   \
+          "classes of the boot loader during startup (0 to disable)")       \
+          range(0, 32)                                                      \
+                                                                            \
   product(bool, PrintSharedArchiveAndExit, false,                           \
           "Print shared archive file contents")                             \
                                                                             \
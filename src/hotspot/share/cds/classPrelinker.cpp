@@ -27,14 +27,19 @@
 #include "cds/classPrelinker.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/constantPool.inline.hpp"
+#include "oops/cpCache.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
+#include "oops/resolvedIndyEntry.hpp"
 #include "runtime/handles.inline.hpp"
 
 ClassPrelinker::ClassesTable* ClassPrelinker::_processed_classes = nullptr;
 ClassPrelinker::ClassesTable* ClassPrelinker::_vm_classes = nullptr;
+int ClassPrelinker::_num_indy_call_sites = 0;
+int ClassPrelinker::_num_string_concat_call_sites = 0;
 
 bool ClassPrelinker::is_vm_class(InstanceKlass* ik) {
   return (_vm_classes->get(ik) != nullptr);
@@ -66,6 +71,8 @@ void ClassPrelinker::initialize() {
 
 void ClassPrelinker::dispose() {
   assert(_vm_classes != nullptr, "must be");
+  log_info(cds)("Invokedynamic call sites left for run time linking: %d (StringConcatFactory: %d)",
+                _num_indy_call_sites, _num_string_concat_call_sites);
   delete _vm_classes;
   delete _processed_classes;
   _vm_classes = nullptr;
@@ -139,6 +146,34 @@ void ClassPrelinker::dumptime_resolve_constants(InstanceKlass* ik, TRAPS) {
       break;
     }
   }
+
+  count_indy_call_sites(cp);
+}
+
+// Resolved invokedynamic call sites are not archived: their CallSite and
+// MethodHandle objects, and the hidden classes behind them, are created by
+// the bootstrap methods at run time. Count them so that -Xlog:cds shows how
+// much linking remains for the archived classes.
+void ClassPrelinker::count_indy_call_sites(constantPoolHandle cp) {
+  ConstantPoolCache* cache = cp->cache();
+  int num_string_concat = 0;
+  for (int i = 0; i < cache->resolved_indy_entries_length(); i++) {
+    int cp_index = cache->resolved_indy_entry_at(i)->constant_pool_index();
+    int bsm_index = cp->bootstrap_method_ref_index_at(cp_index);
+    Symbol* bsm_klass = cp->klass_name_at(cp->method_handle_klass_index_at(bsm_index));
+    if (bsm_klass->equals("java/lang/invoke/StringConcatFactory")) {
+      num_string_concat++;
+    }
+  }
+  _num_indy_call_sites += cache->resolved_indy_entries_length();
+  _num_string_concat_call_sites += num_string_concat;
+
+  if (cache->resolved_indy_entries_length() > 0 && log_is_enabled(Debug, cds, resolve)) {
+    ResourceMark rm;
+    log_debug(cds, resolve)("%s: %d invokedynamic call sites (StringConcatFactory: %d)",
+                            cp->pool_holder()->external_name(),
+                            cache->resolved_indy_entries_length(), num_string_concat);
+  }
 }
 
 Klass* ClassPrelinker::find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name) {
@@ -53,6 +53,12 @@ class ClassPrelinker :  AllStatic {
   static ClassesTable* _processed_classes;
   static ClassesTable* _vm_classes;
 
+  // Number of invokedynamic call sites in the processed classes, which are
+  // linked at run time, and how many of them are bootstrapped by
+  // StringConcatFactory.
+  static int _num_indy_call_sites;
+  static int _num_string_concat_call_sites;
+
   static void add_one_vm_class(InstanceKlass* ik);
 
 #ifdef ASSERT
@@ -67,6 +73,7 @@ class ClassPrelinker :  AllStatic {
   static Klass* maybe_resolve_class(constantPoolHandle cp, int cp_index, TRAPS);
   static bool can_archive_resolved_klass(InstanceKlass* cp_holder, Klass* resolved_klass);
   static Klass* find_loaded_class(JavaThread* THREAD, oop class_loader, Symbol* name);
+  static void count_indy_call_sites(constantPoolHandle cp);
 
 public:
   static void initialize();
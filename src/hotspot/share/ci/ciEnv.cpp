@@ -76,6 +76,7 @@
 #include "runtime/reflection.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/macros.hpp"
 #ifdef COMPILER1
@@ -1715,6 +1716,14 @@ void ciEnv::dump_replay_data(int compile_id) {
   }
 }
 
+bool ciEnv::exceeds_replay_compile_time_threshold() {
+  if (DumpReplayCompileTimeThreshold == 0 || task() == nullptr || failing()) {
+    return false;
+  }
+  jlong elapsed = os::elapsed_counter() - task()->time_started();
+  return (julong)TimeHelper::counter_to_millis(elapsed) >= DumpReplayCompileTimeThreshold;
+}
+
 void ciEnv::dump_inline_data(int compile_id) {
   char buffer[64];
   int ret = jio_snprintf(buffer, sizeof(buffer), "inline_pid%d_compid%d.log", os::current_process_id(), compile_id);
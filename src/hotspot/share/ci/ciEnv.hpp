@@ -492,6 +492,9 @@ public:
   // Dump the compilation replay data for the ciEnv to the stream.
   void dump_replay_data(int compile_id);
   void dump_inline_data(int compile_id);
+  // Whether the current compilation has been running for at least
+  // DumpReplayCompileTimeThreshold milliseconds.
+  bool exceeds_replay_compile_time_threshold();
   void dump_replay_data(outputStream* out);
   void dump_replay_data_unsafe(outputStream* out);
   void dump_replay_data_helper(outputStream* out);
@@ -76,6 +76,7 @@
 #include "utilities/classpathStream.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/powerOfTwo.hpp"
 #include "utilities/utf8.hpp"
 
 // Entry point in java.dll for path canonicalization
@@ -141,6 +142,9 @@ ClassPathEntry* ClassLoader::_jrt_entry = nullptr;
 
 ClassPathEntry* volatile ClassLoader::_first_append_entry_list = nullptr;
 ClassPathEntry* volatile ClassLoader::_last_append_entry  = nullptr;
+Symbol* volatile* ClassLoader::_missing_class_cache = nullptr;
+uint ClassLoader::_missing_class_cache_mask = 0;
+volatile uint ClassLoader::_missing_class_cache_epoch = 0;
 #if INCLUDE_CDS
 ClassPathEntry* ClassLoader::_app_classpath_entries = nullptr;
 ClassPathEntry* ClassLoader::_last_app_classpath_entry = nullptr;
@@ -792,6 +796,43 @@ void ClassLoader::add_to_boot_append_entries(ClassPathEntry *new_entry) {
       _last_append_entry->set_next(new_entry);
       _last_append_entry = new_entry;
     }
+    // Classes previously not found may now be found in the new entry.
+    if (_missing_class_cache != nullptr) {
+      Atomic::release_store(&_missing_class_cache_epoch, _missing_class_cache_epoch + 1);
+      for (uint i = 0; i <= _missing_class_cache_mask; i++) {
+        Symbol* old = Atomic::load(&_missing_class_cache[i]);
+        if (old != nullptr) {
+          Atomic::store(&_missing_class_cache[i], (Symbol*)nullptr);
+          old->decrement_refcount();
+        }
+      }
+    }
+  }
+}
+
+bool ClassLoader::is_known_missing_class(Symbol* class_name) {
+  assert(missing_class_cache_enabled(), "must be");
+  uint index = class_name->identity_hash() & _missing_class_cache_mask;
+  // Pointer comparison only. The caller holds a reference to class_name,
+  // so a match cannot be a different Symbol reusing the same address.
+  return Atomic::load_acquire(&_missing_class_cache[index]) == class_name;
+}
+
+void ClassLoader::record_missing_class(Symbol* class_name, uint epoch) {
+  assert(missing_class_cache_enabled(), "must be");
+  MutexLocker ml(Bootclasspath_lock, Mutex::_no_safepoint_check_flag);
+  if (epoch != _missing_class_cache_epoch) {
+    // The boot append path changed while the caller was searching.
+    return;
+  }
+  uint index = class_name->identity_hash() & _missing_class_cache_mask;
+  Symbol* old = Atomic::load(&_missing_class_cache[index]);
+  if (old != class_name) {
+    class_name->increment_refcount();
+    Atomic::release_store(&_missing_class_cache[index], class_name);
+    if (old != nullptr) {
+      old->decrement_refcount();
+    }
   }
 }
 
@@ -1383,6 +1424,15 @@ void ClassLoader::initialize(TRAPS) {
     NEWPERFEVENTCOUNTER(_unsafe_defineClassCallCounter, SUN_CLS, "unsafeDefineClassCalls");
   }
 
+  if (BootLoaderMissingClassCacheSize > 0) {
+    uint size = round_up_power_of_2((uint)BootLoaderMissingClassCacheSize);
+    _missing_class_cache = NEW_C_HEAP_ARRAY(Symbol* volatile, size, mtClass);
+    for (uint i = 0; i < size; i++) {
+      _missing_class_cache[i] = nullptr;
+    }
+    _missing_class_cache_mask = size - 1;
+  }
+
   // lookup java library entry points
   load_java_library();
   // jimage library entry points are loaded below, in lookup_vm_options
@@ -215,6 +215,14 @@ class ClassLoader: AllStatic {
   // Last entry in linked list of appended ClassPathEntry instances
   static ClassPathEntry* volatile _last_append_entry;
 
+  // Direct-mapped cache of class names the boot loader failed to find
+  // after module initialization, see BootLoaderMissingClassCacheSize.
+  // Slots hold a reference to their Symbol. Entries are added and the
+  // cache is invalidated under the Bootclasspath_lock, and read lock free.
+  static Symbol* volatile* _missing_class_cache;
+  static uint _missing_class_cache_mask;
+  static volatile uint _missing_class_cache_epoch;
+
   // Info used by CDS
   CDS_ONLY(static ClassPathEntry* _app_classpath_entries;)
   CDS_ONLY(static ClassPathEntry* _last_app_classpath_entry;)
@@ -236,6 +244,16 @@ class ClassLoader: AllStatic {
 
   static bool has_bootclasspath_append() { return first_append_entry() != nullptr; }
 
+  // Negative lookup cache for the boot loader. A caller reads the epoch
+  // before searching and passes it to record_missing_class, so that a
+  // search racing with a boot append path change is not recorded.
+  static bool missing_class_cache_enabled() { return _missing_class_cache != nullptr; }
+  static uint missing_class_cache_epoch() {
+    return Atomic::load_acquire(&_missing_class_cache_epoch);
+  }
+  static bool is_known_missing_class(Symbol* class_name);
+  static void record_missing_class(Symbol* class_name, uint epoch);
+
  protected:
   // Initialization:
   //   - setup the boot loader's system class path
@@ -170,6 +170,14 @@ class java_lang_String : AllStatic {
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
+    // Same result as the loop below, but four bytes per step shorten the
+    // dependency chain through h. The constants are 31^4, 31^3 and 31^2.
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 923521*h + 29791*(((unsigned int) s[0]) & 0xFF)
+                   +   961*(((unsigned int) s[1]) & 0xFF)
+                   +    31*(((unsigned int) s[2]) & 0xFF)
+                   +       (((unsigned int) s[3]) & 0xFF);
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
@@ -49,6 +49,7 @@
 #include "oops/weakHandle.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepointVerifiers.hpp"
@@ -56,6 +57,7 @@
 #include "services/diagnosticCommand.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/concurrentHashTableTasks.inline.hpp"
+#include "utilities/globalCounter.inline.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/resizeableResourceHash.hpp"
 #include "utilities/utf8.hpp"
@@ -106,7 +108,12 @@ static SharedStringTable _shared_table;
 // --------------------------------------------------------------------------
 
 typedef ConcurrentHashTable<StringTableConfig, mtSymbol> StringTableHash;
-static StringTableHash* _local_table = nullptr;
+static StringTableHash* volatile _local_table = nullptr;
+// While rehashing, the table that entries are moved out of. It uses the
+// java_lang_String hash and is searched before _local_table.
+static StringTableHash* volatile _rehash_source = nullptr;
+// The table using the alternate hash, once rehashed.
+static StringTableHash* volatile _alt_hash_table = nullptr;
 
 volatile bool StringTable::_has_work = false;
 volatile bool StringTable::_needs_rehashing = false;
@@ -126,6 +133,14 @@ uintx hash_string(const jchar* s, int len, bool useAlt) {
     java_lang_String::hash_code(s, len);
 }
 
+// The hash to use in table, given the java_lang_String hash.
+static uintx hash_for_table(StringTableHash* table, const jchar* s, int len, uintx java_hash) {
+  if (table == Atomic::load_acquire(&_alt_hash_table)) {
+    return hash_string(s, len, true);
+  }
+  return java_hash;
+}
+
 class StringTableConfig : public StackObj {
  private:
  public:
@@ -280,9 +295,6 @@ oop StringTable::lookup(const jchar* name, int len) {
   if (string != nullptr) {
     return string;
   }
-  if (_alt_hash) {
-    hash = hash_string(name, len, true);
-  }
   return do_lookup(name, len, hash);
 }
 
@@ -301,16 +313,39 @@ class StringTableGet : public StackObj {
   }
 };
 
-oop StringTable::do_lookup(const jchar* name, int len, uintx hash) {
-  Thread* thread = Thread::current();
+static oop do_lookup_in(Thread* thread, StringTableHash* table, const jchar* name, int len,
+                        uintx hash, bool* rehash_warning) {
   StringTableLookupJchar lookup(thread, hash, name, len);
   StringTableGet stg(thread);
-  bool rehash_warning;
-  _local_table->get(thread, lookup, stg, &rehash_warning);
-  update_needs_rehash(rehash_warning);
+  table->get(thread, lookup, stg, rehash_warning);
   return stg.get_res_oop();
 }
 
+// The hash is the java_lang_String hash of name.
+oop StringTable::do_lookup(const jchar* name, int len, uintx hash) {
+  Thread* thread = Thread::current();
+  bool rehash_warning = false;
+  oop string = nullptr;
+  {
+    // Keeps the rehash source alive while we search it.
+    GlobalCounter::CriticalSection cs(thread);
+    // The rehash source must be searched first. An entry is moved into the
+    // new table before it is removed from the source, never the other way.
+    StringTableHash* source = Atomic::load_acquire(&_rehash_source);
+    if (source != nullptr) {
+      bool unused;
+      string = do_lookup_in(thread, source, name, len, hash, &unused);
+    }
+    if (string == nullptr) {
+      StringTableHash* table = Atomic::load_acquire(&_local_table);
+      string = do_lookup_in(thread, table, name, len,
+                            hash_for_table(table, name, len, hash), &rehash_warning);
+    }
+  }
+  update_needs_rehash(rehash_warning);
+  return string;
+}
+
 // Interning
 oop StringTable::intern(Symbol* symbol, TRAPS) {
   if (symbol == nullptr) return nullptr;
@@ -351,9 +386,6 @@ oop StringTable::intern(Handle string_or_null_h, const jchar* name, int len, TRA
   if (found_string != nullptr) {
     return found_string;
   }
-  if (_alt_hash) {
-    hash = hash_string(name, len, true);
-  }
   found_string = do_lookup(name, len, hash);
   if (found_string != nullptr) {
     return found_string;
@@ -383,23 +415,31 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
     StringDedup::notify_intern(string_h());
   }
 
-  StringTableLookupOop lookup(THREAD, hash, string_h);
-  StringTableGet stg(THREAD);
-
   bool rehash_warning;
   do {
+    StringTableHash* table = Atomic::load_acquire(&_local_table);
     // Callers have already looked up the String using the jchar* name, so just go to add.
+    // If a rehash is in progress the String may have been added to the rehash source
+    // since, so look again before adding to the new table.
+    if (Atomic::load_acquire(&_rehash_source) != nullptr) {
+      oop found_string = do_lookup(name, len, hash);
+      if (found_string != nullptr) {
+        return found_string;
+      }
+    }
+    StringTableLookupOop lookup(THREAD, hash_for_table(table, name, len, hash), string_h);
     WeakHandle wh(_oop_storage, string_h);
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
-    if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
+    if (table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
-    // This could fail if the String got gc'ed concurrently, so loop back until success.
-    if (_local_table->get(THREAD, lookup, stg, &rehash_warning)) {
-      update_needs_rehash(rehash_warning);
-      return stg.get_res_oop();
+    // This could fail if the String got gc'ed concurrently, or the table got closed
+    // for rehashing, so loop back until success.
+    oop found_string = do_lookup(name, len, hash);
+    if (found_string != nullptr) {
+      return found_string;
     }
   } while(true);
 }
@@ -473,7 +513,13 @@ void StringTable::clean_dead_entries(JavaThread* jt) {
 void StringTable::gc_notification(size_t num_dead) {
   log_trace(stringtable)("Uncleaned items:" SIZE_FORMAT, num_dead);
 
-  if (has_work()) {
+  if (Atomic::load_acquire(&_has_work)) {
+    return;
+  }
+
+  if (needs_rehashing()) {
+    // Wake the service thread for a rehash requested by lookups or interns.
+    trigger_concurrent_work();
     return;
   }
 
@@ -492,14 +538,16 @@ void StringTable::gc_notification(size_t num_dead) {
 }
 
 bool StringTable::has_work() {
-  return Atomic::load_acquire(&_has_work);
+  return Atomic::load_acquire(&_has_work) || Atomic::load_acquire(&_needs_rehashing);
 }
 
 void StringTable::do_concurrent_work(JavaThread* jt) {
   double load_factor = get_load_factor();
   log_debug(stringtable, perf)("Concurrent work, live factor: %g", load_factor);
-  // We prefer growing, since that also removes dead items
-  if (load_factor > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached()) {
+  if (needs_rehashing()) {
+    rehash_table(jt);
+  } else if (should_grow()) {
+    // We prefer growing, since that also removes dead items
     grow(jt);
   } else {
     clean_dead_entries(jt);
@@ -508,25 +556,86 @@ void StringTable::do_concurrent_work(JavaThread* jt) {
 }
 
 // Rehash
-bool StringTable::do_rehash() {
-  if (!_local_table->is_safepoint_safe()) {
+class HandshakeForRehash : public HandshakeClosure {
+ public:
+  HandshakeForRehash() : HandshakeClosure("HandshakeForRehash") {}
+
+  void do_thread(Thread* thread) {}
+};
+
+// Adds a copy of a live entry of the rehash source to the new table, before
+// the source entry is destroyed.
+class StringTableMoveEntry : public StackObj {
+  JavaThread* _thread;
+  StringTableHash* _to;
+ public:
+  size_t _moved;
+  StringTableMoveEntry(JavaThread* thread, StringTableHash* to)
+    : _thread(thread), _to(to), _moved(0) {}
+
+  void operator()(WeakHandle* val) {
+    HandleMark hm(_thread);
+    Handle string_h(_thread, val->resolve());
+    if (string_h.is_null()) {
+      // Dead, removed with the source entry.
+      return;
+    }
+    ResourceMark rm(_thread);
+    int length;
+    jchar* chars = java_lang_String::as_unicode_string_or_null(string_h(), length);
+    if (chars == nullptr) {
+      vm_exit_out_of_memory(length, OOM_MALLOC_ERROR, "rehash string");
+    }
+    StringTableLookupOop lookup(_thread, hash_string(chars, length, true), string_h);
+    WeakHandle wh(StringTable::_oop_storage, string_h);
+    bool inserted = _to->insert(_thread, lookup, wh);
+    assert(inserted, "Interned string must not be in the new table yet");
+    ++_moved;
+  }
+};
+
+// Moves all entries into a new table using the alternate hash. Lookups search
+// the source table, then the new table, and inserts go to the new table only
+// after the source is closed, so no String is ever interned twice.
+bool StringTable::do_rehash(JavaThread* jt) {
+  StringTableHash* old_table = _local_table;
+  StringTableHash::MoveTask mt(old_table);
+  if (!mt.prepare(jt)) {
     return false;
   }
 
   // We use current size, not max size.
-  size_t new_size = _local_table->get_size_log2(Thread::current());
+  size_t new_size = old_table->get_size_log2(jt);
   StringTableHash* new_table = new StringTableHash(new_size, END_SIZE, REHASH_LEN, true);
   // Use alt hash from now on
+  _alt_hash_seed = AltHashing::compute_seed();
   _alt_hash = true;
-  if (!_local_table->try_move_nodes_to(Thread::current(), new_table)) {
-    _alt_hash = false;
-    delete new_table;
-    return false;
-  }
+  Atomic::release_store(&_alt_hash_table, new_table);
+  Atomic::release_store(&_rehash_source, old_table);
+  Atomic::release_store(&_local_table, new_table);
 
-  // free old table
-  delete _local_table;
-  _local_table = new_table;
+  StringTableMoveEntry stme(jt, new_table);
+  {
+    TraceTime timer("Rehash", TRACETIME_LOG(Debug, stringtable, perf));
+    while (mt.do_task(jt, stme)) {
+      mt.pause(jt);
+      {
+        ThreadBlockInVM tbivm(jt);
+      }
+      mt.cont(jt);
+    }
+  }
+  mt.done(jt);
+  log_debug(stringtable)("Moved " SIZE_FORMAT " strings to rehashed table", stme._moved);
+
+  Atomic::release_store(&_rehash_source, (StringTableHash*)nullptr);
+  // Lookups use the source in a critical section, but an intern may have
+  // loaded it as _local_table before we switched. Neither stops for
+  // safepoints or handshakes, so after both it is safe to free the old table.
+  GlobalCounter::write_synchronize();
+  HandshakeForRehash hs_rehash;
+  Handshake::execute(&hs_rehash);
+  delete old_table;
 
   return true;
 }
@@ -535,55 +644,38 @@ bool StringTable::should_grow() {
   return get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached();
 }
 
-bool StringTable::rehash_table_expects_safepoint_rehashing() {
-  // No rehashing required
-  if (!needs_rehashing()) {
-    return false;
+// Called from lookups and interns, which may hold locks ranked below the
+// Service_lock, so only record the request. The service thread checks
+// needs_rehashing() as part of has_work() whenever it wakes up, and the
+// next gc_notification() wakes it up.
+void StringTable::update_needs_rehash(bool rehash) {
+  if (rehash && !_needs_rehashing) {
+    Atomic::release_store(&_needs_rehashing, true);
   }
-
-  // Grow instead of rehash
-  if (should_grow()) {
-    return false;
-  }
-
-  // Already rehashed
-  if (_rehashed) {
-    return false;
-  }
-
-  // Resizing in progress
-  if (!_local_table->is_safepoint_safe()) {
-    return false;
-  }
-
-  return true;
 }
 
-void StringTable::rehash_table() {
+void StringTable::rehash_table(JavaThread* jt) {
   log_debug(stringtable)("Table imbalanced, rehashing called.");
 
   // Grow instead of rehash.
   if (should_grow()) {
     log_debug(stringtable)("Choosing growing over rehashing.");
-    trigger_concurrent_work();
+    grow(jt);
     _needs_rehashing = false;
     return;
   }
   // Already rehashed.
   if (_rehashed) {
     log_warning(stringtable)("Rehashing already done, still long lists.");
-    trigger_concurrent_work();
+    clean_dead_entries(jt);
     _needs_rehashing = false;
     return;
   }
 
-  _alt_hash_seed = AltHashing::compute_seed();
-  {
-    if (do_rehash()) {
-      _rehashed = true;
-    } else {
-      log_info(stringtable)("Resizes in progress rehashing skipped.");
-    }
+  if (do_rehash(jt)) {
+    _rehashed = true;
+  } else {
+    log_info(stringtable)("Resizes in progress rehashing skipped.");
   }
   _needs_rehashing = false;
 }
@@ -648,6 +740,9 @@ class VerifyStrings : StackObj {
 void StringTable::verify() {
   VerifyStrings vs;
   _local_table->do_safepoint_scan(vs);
+  if (_rehash_source != nullptr) {
+    _rehash_source->do_safepoint_scan(vs);
+  }
 }
 
 // Verification and comp
@@ -682,6 +777,13 @@ class VerifyCompStrings : StackObj {
 size_t StringTable::verify_and_compare_entries() {
   Thread* thr = Thread::current();
   VerifyCompStrings vcs;
+  // Scan a rehash source first. Its scan waits until the move is done, so all
+  // strings are found in the new table afterwards. The source is only freed
+  // after a handshake, which can not complete while this thread is scanning.
+  StringTableHash* source = Atomic::load_acquire(&_rehash_source);
+  if (source != nullptr) {
+    source->do_scan(thr, vcs);
+  }
   _local_table->do_scan(thr, vcs);
   return vcs._errors;
 }
@@ -749,7 +851,7 @@ void StringTable::dump(outputStream* st, bool verbose) {
     ResourceMark rm(thr);
     st->print_cr("VERSION: 1.1");
     PrintString ps(thr, st);
-    if (!_local_table->try_scan(thr, ps)) {
+    if (_rehash_source != nullptr || !_local_table->try_scan(thr, ps)) {
       st->print_cr("dump unavailable at this moment");
     }
 #if INCLUDE_CDS_JAVA_HEAP
@@ -40,12 +40,14 @@ class SerializeClosure;
 class StringTable;
 class StringTableConfig;
 class StringTableCreateEntry;
+class StringTableMoveEntry;
 
 class StringTable : public CHeapObj<mtSymbol>{
   friend class VMStructs;
   friend class Symbol;
   friend class StringTableConfig;
   friend class StringTableCreateEntry;
+  friend class StringTableMoveEntry;
 
   static volatile bool _has_work;
 
@@ -75,7 +77,7 @@ class StringTable : public CHeapObj<mtSymbol>{
 
   static void print_table_statistics(outputStream* st);
 
-  static bool do_rehash();
+  static bool do_rehash(JavaThread* jt);
 
  public:
   static size_t table_size();
@@ -95,19 +97,15 @@ class StringTable : public CHeapObj<mtSymbol>{
   static oop intern(oop string, TRAPS);
   static oop intern(const char *utf8_string, TRAPS);
 
-  // Rehash the string table if it gets out of balance
+  // Rehash the string table if it gets out of balance, concurrently
+  // by the service thread.
 private:
   static bool should_grow();
+  static void rehash_table(JavaThread* jt);
 
 public:
-  static bool rehash_table_expects_safepoint_rehashing();
-  static void rehash_table();
   static bool needs_rehashing() { return _needs_rehashing; }
-  static inline void update_needs_rehash(bool rehash) {
-    if (rehash) {
-      _needs_rehashing = true;
-    }
-  }
+  static void update_needs_rehash(bool rehash);
 
   // Sharing
 #if INCLUDE_CDS_JAVA_HEAP
@@ -1258,6 +1258,19 @@ InstanceKlass* SystemDictionary::load_instance_class_impl(Symbol* class_name, Ha
            !search_only_bootloader_append,
            "Attempt to load a class outside of boot loader's module path");
 
+    // After module initialization, the outcome of the search below only
+    // changes when the boot append path grows, so names that were not
+    // found before can be answered from the boot loader's negative cache.
+    bool use_missing_class_cache = ClassLoader::missing_class_cache_enabled() &&
+                                   Universe::is_module_initialized();
+    uint missing_class_epoch = 0;
+    if (use_missing_class_cache) {
+      missing_class_epoch = ClassLoader::missing_class_cache_epoch();
+      if (ClassLoader::is_known_missing_class(class_name)) {
+        return nullptr;
+      }
+    }
+
     // Search for classes in the CDS archive.
     InstanceKlass* k = nullptr;
 
@@ -1277,6 +1290,9 @@ InstanceKlass* SystemDictionary::load_instance_class_impl(Symbol* class_name, Ha
       // Use VM class loader
       PerfTraceTime vmtimer(ClassLoader::perf_sys_classload_time());
       k = ClassLoader::load_class(class_name, search_only_bootloader_append, CHECK_NULL);
+      if (k == nullptr && use_missing_class_cache) {
+        ClassLoader::record_missing_class(class_name, missing_class_epoch);
+      }
     }
 
     // find_or_define_instance_class may return a different InstanceKlass
@@ -1433,6 +1433,30 @@ void SystemDictionaryShared::print_table_statistics(outputStream* st) {
   }
 }
 
+class SharedBootClassCollector : StackObj {
+  GrowableArray<InstanceKlass*>* _classes;
+public:
+  SharedBootClassCollector(GrowableArray<InstanceKlass*>* classes) : _classes(classes) {}
+
+  void do_value(const RunTimeClassInfo* record) {
+    InstanceKlass* ik = record->_klass;
+    if (ik->is_shared_boot_class() && !ik->is_loaded()) {
+      _classes->append(ik);
+    }
+  }
+};
+
+// Collect the archived classes of the boot loader that have not been loaded yet.
+void SystemDictionaryShared::collect_shared_boot_classes(GrowableArray<InstanceKlass*>* classes) {
+  if (UseSharedSpaces) {
+    SharedBootClassCollector collector(classes);
+    _static_archive._builtin_dictionary.iterate(&collector);
+    if (DynamicArchive::is_mapped()) {
+      _dynamic_archive._builtin_dictionary.iterate(&collector);
+    }
+  }
+}
+
 bool SystemDictionaryShared::is_dumptime_table_empty() {
   assert_lock_strong(DumpTimeTable_lock);
   _dumptime_table->update_counts();
@@ -1272,6 +1272,10 @@ void nmethod::inc_decompile_count() {
   if (mdo == nullptr)  return;
   // There is a benign race here.  See comments in methodData.hpp.
   mdo->inc_decompile_count();
+  if (Tier4DeoptBackoffLimit > 0) {
+    // Count the tier 4 thresholds from now on, see CompilationPolicy::deopt_backoff_scale().
+    mdo->reset_start_counters();
+  }
 }
 
 bool nmethod::try_transition(signed char new_state_int) {
@@ -39,6 +39,7 @@
 #include "runtime/frame.inline.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #ifdef COMPILER1
@@ -55,6 +56,8 @@ jlong CompilationPolicy::_start_time = 0;
 int CompilationPolicy::_c1_count = 0;
 int CompilationPolicy::_c2_count = 0;
 double CompilationPolicy::_increase_threshold_at_ratio = 0;
+PerfCounter* CompilationPolicy::_perf_queue_downgrades = nullptr;
+PerfCounter* CompilationPolicy::_perf_stale_tasks = nullptr;
 
 void compilationPolicy_init() {
   CompilationPolicy::initialize();
@@ -211,6 +214,10 @@ bool CompilationPolicy::force_comp_at_level_simple(const methodHandle& method) {
   return false;
 }
 
+bool CompilationPolicy::is_archived_hot(const methodHandle& method) {
+  return UseArchivedCompilationHints && method->is_shared() && method->compiled_at_dump_time();
+}
+
 CompLevel CompilationPolicy::comp_level(Method* method) {
   CompiledMethod *nm = method->code();
   if (nm != nullptr && nm->is_in_use()) {
@@ -219,6 +226,20 @@ CompLevel CompilationPolicy::comp_level(Method* method) {
   return CompLevel_none;
 }
 
+// Back off from recompiling methods whose C2 code keeps being invalidated,
+// e.g. by class hierarchy changes while plugins are loaded.
+double CompilationPolicy::deopt_backoff_scale(const methodHandle& method) {
+  if (Tier4DeoptBackoffLimit == 0) {
+    return 1;
+  }
+  MethodData* mdo = method->method_data();
+  if (mdo == nullptr) {
+    return 1;
+  }
+  uint shift = MIN2(mdo->decompile_count(), (uint)Tier4DeoptBackoffLimit);
+  return (double)((jlong)1 << shift);
+}
+
 // Call and loop predicates determine whether a transition to a higher
 // compilation level should be performed (pointers to predicate functions
 // are passed to common()).
@@ -253,7 +274,8 @@ public:
       break;
     }
     case CompLevel_full_profile: {
-      k = CompilationPolicy::threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+      k = CompilationPolicy::threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback) *
+          CompilationPolicy::deopt_backoff_scale(method);
       break;
     }
     default:
@@ -292,7 +314,8 @@ public:
       break;
     }
     case CompLevel_full_profile: {
-      k = CompilationPolicy::threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback);
+      k = CompilationPolicy::threshold_scale(CompLevel_full_optimization, Tier4LoadFeedback) *
+          CompilationPolicy::deopt_backoff_scale(method);
       break;
     }
     default:
@@ -499,6 +522,16 @@ void CompilationPolicy::initialize() {
     set_increase_threshold_at_ratio();
   }
   set_start_time(nanos_to_millis(os::javaTimeNanos()));
+
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    _perf_queue_downgrades =
+                 PerfDataManager::create_counter(SUN_CI, "queueDowngrades",
+                                                 PerfData::U_Events, CHECK);
+    _perf_stale_tasks =
+                 PerfDataManager::create_counter(SUN_CI, "staleTasks",
+                                                 PerfData::U_Events, CHECK);
+  }
 }
 
 
@@ -642,6 +675,9 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       }
       method->clear_queued_for_compilation();
       compile_queue->remove_and_mark_stale(task);
+      if (UsePerfData) {
+        _perf_stale_tasks->inc();
+      }
       task = next_task;
       continue;
     }
@@ -674,8 +710,15 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   methodHandle max_method_h(Thread::current(), max_method);
 
   if (max_task != nullptr && max_task->comp_level() == CompLevel_full_profile && TieredStopAtLevel > CompLevel_full_profile &&
-      max_method != nullptr && is_method_profiled(max_method_h) && !Arguments::is_compiler_only()) {
+      max_method != nullptr && !Arguments::is_compiler_only() &&
+      (is_method_profiled(max_method_h) || (TieredCompileQueueByBenefit && is_c1_queue_overloaded()))) {
+    // Either the method has been profiled enough already, or the C1 queue is too long to
+    // spend time on full profiling code. The limited profile code transitions to tier 3
+    // or 4 later on, see common().
     max_task->set_comp_level(CompLevel_limited_profile);
+    if (UsePerfData) {
+      _perf_queue_downgrades->inc();
+    }
 
     if (CompileBroker::compilation_is_complete(max_method_h, max_task->osr_bci(), CompLevel_limited_profile)) {
       if (PrintTieredEvents) {
@@ -877,6 +920,21 @@ double CompilationPolicy::weight(Method* method) {
   return (double)(method->rate() + 1) * (method->invocation_count() + 1) * (method->backedge_count() + 1);
 }
 
+// The benefit of a compilation is approximated by the interpreter time it
+// saves: the event rate times the bytecodes executed per event. The latter
+// is taken as the logarithm of the method size, since large methods are
+// also more expensive to compile and rarely run all of their code.
+double CompilationPolicy::benefit(Method* method) {
+  double cost = 1 + log2i_graceful(method->code_size() + 1);
+  return (double)(method->rate() + 1) * cost *
+         ((double)method->invocation_count() + method->backedge_count() + 1);
+}
+
+bool CompilationPolicy::is_c1_queue_overloaded() {
+  return CompileBroker::queue_size(CompLevel_full_profile) >
+         Tier3DelayOn * compiler_count(CompLevel_full_profile);
+}
+
 // Apply heuristics and return true if x should be compiled before y
 bool CompilationPolicy::compare_methods(Method* x, Method* y) {
   if (x->highest_comp_level() > y->highest_comp_level()) {
@@ -884,6 +942,9 @@ bool CompilationPolicy::compare_methods(Method* x, Method* y) {
     return true;
   } else
     if (x->highest_comp_level() == y->highest_comp_level()) {
+      if (TieredCompileQueueByBenefit) {
+        return benefit(x) > benefit(y);
+      }
       if (weight(x) > weight(y)) {
         return true;
       }
@@ -1118,6 +1179,12 @@ CompLevel CompilationPolicy::call_event(const methodHandle& method, CompLevel cu
   } else {
     next_level = MAX2(osr_level, next_level);
   }
+  // A method that was hot in the run that dumped the archive is profiled
+  // right away instead of after the interpreter thresholds.
+  if (cur_level == CompLevel_none && next_level == CompLevel_none &&
+      !CompilationModeFlag::disable_intermediate() && is_archived_hot(method)) {
+    next_level = limit_level(CompLevel_full_profile);
+  }
   return next_level;
 }
 
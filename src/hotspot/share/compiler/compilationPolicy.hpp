@@ -176,6 +176,8 @@ class CompilationPolicy : AllStatic {
   static jlong _start_time;
   static int _c1_count, _c2_count;
   static double _increase_threshold_at_ratio;
+  static PerfCounter* _perf_queue_downgrades;
+  static PerfCounter* _perf_stale_tasks;
 
   // Set carry flags in the counters (in Method* and MDO).
   inline static void handle_counter_overflow(const methodHandle& method);
@@ -203,6 +205,11 @@ class CompilationPolicy : AllStatic {
   inline static bool is_stale(jlong t, jlong timeout, const methodHandle& method);
   // Compute the weight of the method for the compilation scheduling
   inline static double weight(Method* method);
+  // Estimate the interpreter time saved per millisecond by compiling the method,
+  // used instead of weight() with TieredCompileQueueByBenefit
+  inline static double benefit(Method* method);
+  // Is the C1 queue too long to keep compiling with full profiling?
+  inline static bool is_c1_queue_overloaded();
   // Apply heuristics and return true if x should be compiled before y
   inline static bool compare_methods(Method* x, Method* y);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
@@ -210,6 +217,8 @@ class CompilationPolicy : AllStatic {
   inline static void update_rate(jlong t, const methodHandle& method);
   // Compute threshold scaling coefficient
   inline static double threshold_scale(CompLevel level, int feedback_k);
+  // Compute the scaling of the tier 4 thresholds for a method that was deoptimized
+  static double deopt_backoff_scale(const methodHandle& method);
   // If a method is old enough and is still in the interpreter we would want to
   // start profiling without waiting for the compiled method to arrive. This function
   // determines whether we should do that.
@@ -231,6 +240,9 @@ class CompilationPolicy : AllStatic {
   inline static bool is_trivial(const methodHandle& method);
   // Force method to be compiled at CompLevel_simple?
   inline static bool force_comp_at_level_simple(const methodHandle& method);
+  // Did the method have C2 code when the dynamic archive it was loaded from
+  // was dumped?
+  static bool is_archived_hot(const methodHandle& method);
 
   // Get a compilation level for a given method.
   static CompLevel comp_level(Method* method);
@@ -596,6 +596,7 @@ void CompileBroker::compilation_init_phase1(JavaThread* THREAD) {
   if (!UseCompiler) {
     return;
   }
+  TraceTime timer("Initialize compilers", TRACETIME_LOG(Info, startuptime));
   // Set the interface to the current compiler(s).
   _c1_count = CompilationPolicy::c1_count();
   _c2_count = CompilationPolicy::c2_count();
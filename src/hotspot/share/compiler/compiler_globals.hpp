@@ -243,6 +243,12 @@
           "reaches this amount per compiler thread")                        \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, Tier4DeoptBackoffLimit, 0, EXPERIMENTAL,                    \
+          "Tier 4 thresholds of a method double each time its C2 code is "  \
+          "invalidated, up to this power of two. The method also starts "   \
+          "profiling anew before it is recompiled (0 to disable)")          \
+          range(0, 16)                                                      \
+                                                                            \
   product(intx, TieredCompileTaskTimeout, 50,                               \
           "Kill compile task if method was not used within "                \
           "given timeout in milliseconds")                                  \
@@ -270,6 +276,11 @@
           "Maximum rate sampling interval (in milliseconds)")               \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, TieredCompileQueueByBenefit, false, EXPERIMENTAL,           \
+          "Select compile tasks by estimated benefit (event rate times "    \
+          "the interpreter cost of the method) and compile at tier 2 "      \
+          "instead of tier 3 while the C1 queue is overloaded")             \
+                                                                            \
   product(ccstr, CompilationMode, "default",                                \
           "Compilation modes: "                                             \
           "default: normal tiered compilation; "                            \
@@ -334,6 +345,10 @@
   product(bool, DumpReplayDataOnError, true,                                \
           "Record replay data for crashing compiler threads")               \
                                                                             \
+  product(uintx, DumpReplayCompileTimeThreshold, 0, DIAGNOSTIC,             \
+          "Record replay data for successful compilations that take at "    \
+          "least this many milliseconds; 0 disables")                       \
+                                                                            \
   product(bool, CompilerDirectivesIgnoreCompileCommands, false, DIAGNOSTIC, \
              "Disable backwards compatibility for compile commands.")       \
                                                                             \
@@ -294,6 +294,7 @@ HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
 G1PLABAllocator::PLABData::PLABData() :
   _alloc_buffer(nullptr),
   _direct_allocated(0),
+  _plab_allocated(0),
   _num_plab_fills(0),
   _num_direct_allocations(0),
   _plab_fill_counter(0),
@@ -362,6 +363,20 @@ bool G1PLABAllocator::may_throw_away_buffer(size_t const allocation_word_sz, siz
   return (allocation_word_sz * 100 < buffer_size * ParallelGCBufferWastePct);
 }
 
+size_t G1PLABAllocator::boosted_plab_size(region_type_t dest, size_t cur_plab_size) const {
+  size_t result = cur_plab_size * 2;
+  if (G1PLABCopyRateSizing) {
+    // A thread that already copied a lot during this pause is likely to continue
+    // doing so. Size the PLAB so that throwing away one buffer stays within the
+    // waste target with respect to what this thread allocated so far, which
+    // avoids repeated doubling (and refills) for the threads doing most of the
+    // copying while not affecting threads that copy little.
+    size_t rate_based_size = _dest_data[dest].allocated() * TargetPLABWastePct / 100;
+    result = MAX2(result, rate_based_size);
+  }
+  return _g1h->clamp_plab_size(result);
+}
+
 HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
                                                        size_t word_sz,
                                                        bool* plab_refill_failed,
@@ -372,7 +387,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
   PLABData* plab_data = &_dest_data[dest.type()];
 
   if (plab_data->should_boost()) {
-    next_plab_word_size = _g1h->clamp_plab_size(next_plab_word_size * 2);
+    next_plab_word_size = boosted_plab_size(dest.type(), next_plab_word_size);
   }
 
   size_t required_in_plab = PLAB::size_required_for_allocation(word_sz);
@@ -404,6 +419,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
 
     if (buf != nullptr) {
       alloc_buf->set_buf(buf, actual_plab_size);
+      plab_data->_plab_allocated += actual_plab_size;
 
       HeapWord* const obj = alloc_buf->allocate(word_sz);
       assert(obj != nullptr, "PLAB should have been big enough, tried to allocate "
@@ -470,6 +486,22 @@ size_t G1PLABAllocator::plab_size(G1HeapRegionAttr which) const {
   return _dest_data[which.type()]._cur_desired_plab_size;
 }
 
+size_t G1PLABAllocator::num_plab_fills() const {
+  size_t result = 0;
+  for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
+    result += _dest_data[state]._num_plab_fills;
+  }
+  return result;
+}
+
+size_t G1PLABAllocator::num_direct_allocations() const {
+  size_t result = 0;
+  for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
+    result += _dest_data[state]._num_direct_allocations;
+  }
+  return result;
+}
+
 size_t G1PLABAllocator::undo_waste() const {
   size_t result = 0;
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
@@ -158,6 +158,7 @@ private:
     PLAB** _alloc_buffer;
 
     size_t _direct_allocated;             // Number of words allocated directly (not counting PLAB allocation).
+    size_t _plab_allocated;               // Number of words allocated for PLABs so far.
     size_t _num_plab_fills;               // Number of PLAB refills experienced so far.
     size_t _num_direct_allocations;       // Number of direct allocations experienced so far.
 
@@ -178,6 +179,9 @@ private:
 
     void notify_plab_refill(size_t tolerated_refills, size_t next_plab_size);
 
+    // Total number of words this thread allocated into this destination so far.
+    size_t allocated() const { return _plab_allocated + _direct_allocated; }
+
   } _dest_data[G1HeapRegionAttr::Num];
 
   // The amount of PLAB refills tolerated until boosting PLAB size.
@@ -195,6 +199,10 @@ private:
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
+
+  // Returns the PLAB size to use for the next refill of the given destination
+  // when boosting, based on this thread's own allocation rate so far.
+  size_t boosted_plab_size(region_type_t dest, size_t cur_plab_size) const;
 public:
   G1PLABAllocator(G1Allocator* allocator);
 
@@ -202,6 +210,10 @@ public:
   size_t undo_waste() const;
   size_t plab_size(G1HeapRegionAttr which) const;
 
+  // Number of PLAB refills and direct allocations across all destinations.
+  size_t num_plab_fills() const;
+  size_t num_direct_allocations() const;
+
   // Allocate word_sz words in dest, either directly into the regions or by
   // allocating a new PLAB. Returns the address of the allocated memory, null if
   // not successful. Plab_refill_failed indicates whether an attempt to refill the
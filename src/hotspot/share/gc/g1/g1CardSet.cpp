@@ -333,6 +333,11 @@ public:
     _table.do_scan(Thread::current(), scan_f);
   }
 
+  template <typename EVAL_FUNC, typename DELETE_FUNC>
+  bool try_bulk_delete(EVAL_FUNC& eval_f, DELETE_FUNC& delete_f) {
+    return _table.try_bulk_delete(Thread::current(), eval_f, delete_f);
+  }
+
   void reset() {
     if (Atomic::load(&_inserted_card)) {
       _table.unsafe_reset(InitialLogTableSize);
@@ -1033,6 +1038,37 @@ void G1CardSet::clear() {
   _mm->flush();
 }
 
+size_t G1CardSet::remove_stale_containers(CardRegionFilter* filter) {
+  uint const log2_card_regions_per_region = _config->log2_card_regions_per_heap_region();
+
+  auto is_stale = [&] (G1CardSetHashTableValue* value) {
+    return filter->is_stale(value->_region_idx >> log2_card_regions_per_region);
+  };
+
+  size_t num_removed = 0;
+  size_t num_cards_removed = 0;
+  auto release = [&] (G1CardSetHashTableValue* value) {
+    ContainerPtr container = value->_container;
+    // Nobody else may add to this container any more, so we can release the
+    // containers stored in a Howl directly.
+    if (container_type(container) == ContainerHowl && container != FullCardSet) {
+      G1ReleaseCardsets rel(this);
+      container_ptr<G1CardSetHowl>(container)->iterate(rel, _config->num_buckets_in_howl());
+    }
+    release_and_maybe_free_container(container);
+
+    num_cards_removed += value->_num_occupied;
+    num_removed++;
+  };
+
+  if (!_table->try_bulk_delete(is_stale, release)) {
+    return 0;
+  }
+
+  Atomic::sub(&_num_occupied, MIN2(num_cards_removed, Atomic::load(&_num_occupied)), memory_order_relaxed);
+  return num_removed;
+}
+
 void G1CardSet::reset_table_scanner() {
   _table->reset_table_scanner();
 }
@@ -378,6 +378,21 @@ public:
   // Clear the entire contents of this remembered set.
   void clear();
 
+  // Decides whether the cards of the given heap region in a card set are stale,
+  // i.e. that region can not contain references into the owner of the card set
+  // any more.
+  class CardRegionFilter {
+  public:
+    virtual bool is_stale(uint region_idx) = 0;
+  };
+
+  // Removes and frees the containers of all card regions belonging to heap
+  // regions the filter determines as stale. Returns the number of removed
+  // containers, zero if the table could not be locked for removal.
+  // The caller must make sure that no cards are added concurrently for the
+  // regions determined as stale.
+  size_t remove_stale_containers(CardRegionFilter* filter);
+
   void reset_table_scanner();
 
   // Iterate over the container, calling a method on every card or card range contained
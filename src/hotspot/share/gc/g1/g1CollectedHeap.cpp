@@ -61,6 +61,7 @@
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "gc/g1/g1RemSet.hpp"
+#include "gc/g1/g1RemSetCompactionTask.hpp"
 #include "gc/g1/g1RootClosures.hpp"
 #include "gc/g1/g1RootProcessor.hpp"
 #include "gc/g1/g1SATBMarkQueueSet.hpp"
@@ -1216,6 +1217,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _service_thread(nullptr),
   _periodic_gc_task(nullptr),
   _free_arena_memory_task(nullptr),
+  _remset_compaction_task(nullptr),
   _workers(nullptr),
   _card_table(nullptr),
   _collection_pause_end(Ticks::now()),
@@ -1492,6 +1494,9 @@ jint G1CollectedHeap::initialize() {
   _free_arena_memory_task = new G1MonotonicArenaFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_arena_memory_task);
 
+  _remset_compaction_task = new G1RemSetCompactionTask("Remembered Set Compaction Task");
+  _service_thread->register_task(_remset_compaction_task, G1RemSetCompactionInterval);
+
   // Here we allocate the dummy HeapRegion that is required by the
   // G1AllocRegion class.
   HeapRegion* dummy_region = _hrm.get_dummy_region();
@@ -2180,12 +2185,24 @@ bool G1CollectedHeap::is_obj_dead_cond(const oop obj,
   return false; // keep some compilers happy
 }
 
+// Pinning is done per region: G1 does not evacuate or compact regions that
+// contain pinned objects instead of blocking garbage collections using the
+// GCLocker. Pinning and unpinning happen outside of safepoints.
 void G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
-  GCLocker::lock_critical(thread);
+  assert(obj != nullptr, "obj must not be null");
+  assert(!SafepointSynchronize::is_at_safepoint(), "must not be at safepoint");
+  assert(!is_gc_active(), "must not pin objects during a GC");
+
+  HeapRegion* r = heap_region_containing(obj);
+  r->increment_pinned_object_count();
 }
 
 void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
-  GCLocker::unlock_critical(thread);
+  assert(obj != nullptr, "obj must not be null");
+  assert(!is_gc_active(), "must not unpin objects during a GC");
+
+  HeapRegion* r = heap_region_containing(obj);
+  r->decrement_pinned_object_count();
 }
 
 void G1CollectedHeap::print_heap_regions() const {
@@ -212,6 +212,10 @@ void G1CollectedHeap::register_humongous_candidate_region_with_region_attr(uint
   _region_attr.set_humongous_candidate(index, region_at(index)->rem_set()->is_tracked());
 }
 
+void G1CollectedHeap::register_young_region_with_region_attr(HeapRegion* r) {
+  _region_attr.set_in_young(r->hrm_index(), r->has_pinned_objects());
+}
+
 void G1CollectedHeap::register_new_survivor_region_with_region_attr(HeapRegion* r) {
   _region_attr.set_new_survivor_region(r->hrm_index());
 }
@@ -221,7 +225,7 @@ void G1CollectedHeap::register_region_with_region_attr(HeapRegion* r) {
 }
 
 void G1CollectedHeap::register_old_region_with_region_attr(HeapRegion* r) {
-  _region_attr.set_in_old(r->hrm_index(), r->rem_set()->is_tracked());
+  _region_attr.set_in_old(r->hrm_index(), r->rem_set()->is_tracked(), r->has_pinned_objects());
   _rem_set->exclude_region_from_scan(r->hrm_index());
 }
 
@@ -1360,8 +1360,15 @@ class G1ReclaimEmptyRegionsTask : public WorkerTask {
     uint old_regions_removed() { return _old_regions_removed; }
     uint humongous_regions_removed() { return _humongous_regions_removed; }
 
+    // Memory of pinned objects must stay valid even if they are dead. For
+    // humongous objects the pin is tracked in the starts humongous region.
+    static bool is_pinned(HeapRegion* hr) {
+      HeapRegion* r = hr->is_humongous() ? hr->humongous_start_region() : hr;
+      return r->has_pinned_objects();
+    }
+
     bool do_heap_region(HeapRegion *hr) {
-      if (hr->used() > 0 && hr->live_bytes() == 0 && !hr->is_young()) {
+      if (hr->used() > 0 && hr->live_bytes() == 0 && !hr->is_young() && !is_pinned(hr)) {
         log_trace(gc)("Reclaimed empty old gen region %u (%s) bot " PTR_FORMAT,
                       hr->hrm_index(), hr->get_short_type_str(), p2i(hr->bottom()));
         _freed_bytes += hr->used();
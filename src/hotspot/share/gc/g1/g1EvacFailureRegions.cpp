@@ -35,7 +35,9 @@
 G1EvacFailureRegions::G1EvacFailureRegions() :
   _regions_failed_evacuation(mtGC),
   _evac_failure_regions(nullptr),
-  _evac_failure_regions_cur_length(0) { }
+  _evac_failure_regions_cur_length(0),
+  _num_regions_pinned(0),
+  _num_regions_alloc_failed(0) { }
 
 G1EvacFailureRegions::~G1EvacFailureRegions() {
   assert(_evac_failure_regions == nullptr, "not cleaned up");
@@ -43,6 +45,8 @@ G1EvacFailureRegions::~G1EvacFailureRegions() {
 
 void G1EvacFailureRegions::pre_collection(uint max_regions) {
   Atomic::store(&_evac_failure_regions_cur_length, 0u);
+  Atomic::store(&_num_regions_pinned, 0u);
+  Atomic::store(&_num_regions_alloc_failed, 0u);
   _regions_failed_evacuation.resize(max_regions);
   _evac_failure_regions = NEW_C_HEAP_ARRAY(uint, max_regions, mtGC);
 }
@@ -36,6 +36,11 @@ class HeapRegionClaimer;
 // This class records for every region on the heap whether evacuation failed for it,
 // and records for every evacuation failure region to speed up iteration of these
 // regions in post evacuation phase.
+// Evacuation fails for a region either because an object could not be copied
+// (allocation failure) or because the region contains pinned objects and must
+// be retained in place. Both are handled the same in the post evacuation phase,
+// but only allocation failures are evacuation failures in the sense of the
+// policy and for logging.
 class G1EvacFailureRegions {
   // Records for every region on the heap whether evacuation failed for it.
   CHeapBitMap _regions_failed_evacuation;
@@ -43,6 +48,10 @@ class G1EvacFailureRegions {
   uint* _evac_failure_regions;
   // Number of regions evacuation failed in the current collection.
   volatile uint _evac_failure_regions_cur_length;
+  // Number of regions retained because of pinned objects.
+  volatile uint _num_regions_pinned;
+  // Number of regions with allocation failures.
+  volatile uint _num_regions_alloc_failed;
 
 public:
   G1EvacFailureRegions();
@@ -70,14 +79,24 @@ public:
     return Atomic::load(&_evac_failure_regions_cur_length);
   }
 
-  bool evacuation_failed() const {
+  // Whether any region has been retained, for any reason.
+  bool has_regions_evac_failed() const {
     return num_regions_failed_evacuation() > 0;
   }
 
+  bool has_regions_evac_pinned() const {
+    return Atomic::load(&_num_regions_pinned) > 0;
+  }
+
+  bool has_regions_alloc_failed() const {
+    return Atomic::load(&_num_regions_alloc_failed) > 0;
+  }
+
   // Record that the garbage collection encountered an evacuation failure in the
-  // given region. Returns whether this has been the first occurrence of an evacuation
-  // failure in that region.
-  inline bool record(uint region_idx);
+  // given region, either because it is pinned or because of an allocation failure.
+  // Returns whether this has been the first occurrence of an evacuation failure
+  // in that region.
+  inline bool record(uint region_idx, bool cause_pinned);
 };
 
 #endif //SHARE_GC_G1_G1EVACFAILUREREGIONS_HPP
@@ -28,7 +28,7 @@
 #include "gc/g1/g1EvacFailureRegions.hpp"
 #include "runtime/atomic.hpp"
 
-bool G1EvacFailureRegions::record(uint region_idx) {
+bool G1EvacFailureRegions::record(uint region_idx, bool cause_pinned) {
   bool success = _regions_failed_evacuation.par_set_bit(region_idx,
                                                         memory_order_relaxed);
   if (success) {
@@ -39,6 +39,14 @@ bool G1EvacFailureRegions::record(uint region_idx) {
     HeapRegion* hr = g1h->region_at(region_idx);
     G1CollectorState* state = g1h->collector_state();
     hr->note_evacuation_failure(state->in_concurrent_start_gc());
+
+    // Objects in regions with pinned objects are never copied, so all
+    // evacuation failures of a region have the same cause.
+    if (cause_pinned) {
+      Atomic::inc(&_num_regions_pinned, memory_order_relaxed);
+    } else {
+      Atomic::inc(&_num_regions_alloc_failed, memory_order_relaxed);
+    }
   }
   return success;
 }
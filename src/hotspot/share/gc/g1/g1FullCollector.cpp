@@ -129,7 +129,8 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap,
     _humongous_compaction_regions(8),
     _always_subject_to_discovery(),
     _is_subject_mutator(heap->ref_processor_stw(), &_always_subject_to_discovery),
-    _region_attr_table() {
+    _region_attr_table(),
+    _early_reset_claimer(_num_workers) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
 
   _preserved_marks_set.init(_num_workers);
@@ -256,9 +257,10 @@ void G1FullCollector::complete_collection() {
 void G1FullCollector::before_marking_update_attribute_table(HeapRegion* hr) {
   if (hr->is_free()) {
     _region_attr_table.set_free(hr->hrm_index());
-  } else if (hr->is_humongous()) {
+  } else if (hr->is_humongous() || hr->has_pinned_objects()) {
     // Humongous objects will never be moved in the "main" compaction phase, but
-    // afterwards in a special phase if needed.
+    // afterwards in a special phase if needed. Regions with pinned objects are
+    // never compacted.
     _region_attr_table.set_skip_compacting(hr->hrm_index());
   } else {
     // Everything else should be compacted.
@@ -31,6 +31,7 @@
 #include "gc/g1/g1FullGCOopClosures.hpp"
 #include "gc/g1/g1FullGCScope.hpp"
 #include "gc/g1/g1RegionMarkStatsCache.hpp"
+#include "gc/g1/heapRegionManager.hpp"
 #include "gc/shared/gcId.hpp"
 #include "gc/shared/gcTraceTime.hpp"
 #include "gc/shared/preservedMarks.hpp"
@@ -98,6 +99,10 @@ class G1FullCollector : StackObj {
 
   HeapWord* volatile* _compaction_tops;
 
+  // Tracks skip-compacting regions whose metadata has already been reset
+  // by workers that finished their compaction work early.
+  HeapRegionClaimer _early_reset_claimer;
+
 public:
   G1FullCollector(G1CollectedHeap* heap,
                   bool clear_soft_refs,
@@ -118,6 +123,7 @@ public:
   PreservedMarksSet*       preserved_mark_set() { return &_preserved_marks_set; }
   G1FullGCCompactionPoint* serial_compaction_point() { return &_serial_compaction_point; }
   G1FullGCCompactionPoint* humongous_compaction_point() { return &_humongous_compaction_point; }
+  HeapRegionClaimer*       early_reset_claimer() { return &_early_reset_claimer; }
   G1CMBitMap*              mark_bitmap();
   ReferenceProcessor*      reference_processor();
   size_t live_words(uint region_index) const {
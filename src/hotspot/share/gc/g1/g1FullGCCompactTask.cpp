@@ -23,11 +23,12 @@
  */
 
 #include "precompiled.hpp"
-#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/g1FullCollector.inline.hpp"
 #include "gc/g1/g1FullGCCompactionPoint.hpp"
 #include "gc/g1/g1FullGCCompactTask.hpp"
+#include "gc/g1/g1FullGCResetMetadataTask.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
@@ -92,6 +93,29 @@ void G1FullGCCompactTask::work(uint worker_id) {
        ++it) {
     compact_region(*it);
   }
+
+  if (G1FullGCOverlapResetMetadata) {
+    reset_regions_during_compaction(worker_id);
+  }
+}
+
+void G1FullGCCompactTask::reset_regions_during_compaction(uint worker_id) {
+  HeapRegionClaimer* claimer = collector()->early_reset_claimer();
+  G1FullGCResetMetadataTask::G1ResetMetadataClosure cl(collector());
+
+  const uint n_regions = claimer->n_regions();
+  const uint start_index = claimer->offset_for_worker(worker_id);
+  for (uint count = 0; count < n_regions; count++) {
+    const uint index = (start_index + count) % n_regions;
+    HeapRegion* hr = _g1h->region_at_or_null(index);
+    if (hr == nullptr ||
+        !cl.can_reset_during_compaction(hr) ||
+        claimer->is_region_claimed(index) ||
+        !claimer->claim_region(index)) {
+      continue;
+    }
+    cl.reset_during_compaction(hr);
+  }
 }
 
 void G1FullGCCompactTask::serial_compaction() {
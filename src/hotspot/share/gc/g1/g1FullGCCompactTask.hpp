@@ -41,6 +41,9 @@ class G1FullGCCompactTask : public G1FullGCTask {
   G1CollectedHeap* _g1h;
 
   void compact_region(HeapRegion* hr);
+  // Reset metadata of regions not affected by compaction to overlap this work
+  // with other workers still compacting.
+  void reset_regions_during_compaction(uint worker_id);
   void compact_humongous_obj(HeapRegion* hr);
   void free_non_overlapping_regions(uint src_start_idx, uint dest_start_idx, uint num_regions);
 
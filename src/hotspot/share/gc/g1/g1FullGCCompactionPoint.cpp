@@ -25,7 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1FullCollector.inline.hpp"
 #include "gc/g1/g1FullGCCompactionPoint.hpp"
-#include "gc/g1/heapRegion.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "utilities/debug.hpp"
@@ -152,7 +152,7 @@ uint G1FullGCCompactionPoint::forward_humongous(HeapRegion* hr) {
   size_t obj_size = obj->size();
   uint num_regions = (uint)G1CollectedHeap::humongous_obj_size_in_regions(obj_size);
 
-  if (!has_regions()) {
+  if (!has_regions() || hr->has_pinned_objects()) {
     return num_regions;
   }
 
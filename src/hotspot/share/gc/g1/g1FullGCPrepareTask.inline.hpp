@@ -42,7 +42,7 @@ void G1DetermineCompactionQueueClosure::free_empty_humongous_region(HeapRegion*
 inline bool G1DetermineCompactionQueueClosure::should_compact(HeapRegion* hr) const {
   // There is no need to iterate and forward objects in non-movable regions ie.
   // prepare them for compaction.
-  if (hr->is_humongous()) {
+  if (hr->is_humongous() || hr->has_pinned_objects()) {
     return false;
   }
   size_t live_words = _collector->live_words(hr->hrm_index());
@@ -80,13 +80,19 @@ inline bool G1DetermineCompactionQueueClosure::do_heap_region(HeapRegion* hr) {
   } else {
     assert(hr->containing_set() == nullptr, "already cleared by PrepareRegionsClosure");
     if (hr->is_humongous()) {
-      oop obj = cast_to_oop(hr->humongous_start_region()->bottom());
-      bool is_empty = !_collector->mark_bitmap()->is_marked(obj);
+      HeapRegion* start_region = hr->humongous_start_region();
+      oop obj = cast_to_oop(start_region->bottom());
+      // A dead pinned humongous object must not be freed either.
+      bool is_empty = !_collector->mark_bitmap()->is_marked(obj) && !start_region->has_pinned_objects();
       if (is_empty) {
         free_empty_humongous_region(hr);
       } else {
         _collector->set_has_humongous();
       }
+    } else if (hr->has_pinned_objects()) {
+      // Already marked as skip compacting when preparing for marking.
+      log_trace(gc, phases)("Phase 2: skip compaction pinned region index: %u, live words: " SIZE_FORMAT,
+                            hr->hrm_index(), _collector->live_words(hr->hrm_index()));
     } else {
       assert(MarkSweepDeadRatio > 0,
              "only skip compaction for other regions when MarkSweepDeadRatio > 0");
@@ -36,17 +36,39 @@ void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_region_metadata(He
   hr->clear_cardtable();
 }
 
+void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_not_compaction_target(HeapRegion* hr) {
+  uint const region_idx = hr->hrm_index();
+  assert(!hr->is_free(), "all free regions should be compaction targets");
+  assert(_collector->is_skip_compacting(region_idx), "must be");
+  if (hr->needs_scrubbing_during_full_gc()) {
+    scrub_skip_compacting_region(hr, hr->is_young());
+  }
+  if (_collector->is_skip_compacting(region_idx)) {
+    reset_skip_compacting(hr);
+  }
+}
+
+bool G1FullGCResetMetadataTask::G1ResetMetadataClosure::can_reset_during_compaction(HeapRegion* hr) const {
+  // Compaction only ever reads from and writes to compaction targets, with the
+  // exception of humongous objects that may be moved during maximal compaction.
+  return !_collector->is_compaction_target(hr->hrm_index()) && !hr->is_humongous();
+}
+
+void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_during_compaction(HeapRegion* hr) {
+  assert(can_reset_during_compaction(hr), "must be");
+  assert(_collector->early_reset_claimer()->is_region_claimed(hr->hrm_index()), "must be");
+  reset_not_compaction_target(hr);
+  reset_region_metadata(hr);
+}
+
 bool G1FullGCResetMetadataTask::G1ResetMetadataClosure::do_heap_region(HeapRegion* hr) {
   uint const region_idx = hr->hrm_index();
   if (!_collector->is_compaction_target(region_idx)) {
-    assert(!hr->is_free(), "all free regions should be compaction targets");
-    assert(_collector->is_skip_compacting(region_idx), "must be");
-    if (hr->needs_scrubbing_during_full_gc()) {
-      scrub_skip_compacting_region(hr, hr->is_young());
-    }
-    if (_collector->is_skip_compacting(region_idx)) {
-      reset_skip_compacting(hr);
+    if (_collector->early_reset_claimer()->is_region_claimed(region_idx)) {
+      // Already reset during compaction.
+      return false;
     }
+    reset_not_compaction_target(hr);
   }
   // Reset data structures not valid after Full GC.
   reset_region_metadata(hr);
@@ -88,9 +110,11 @@ void G1FullGCResetMetadataTask::G1ResetMetadataClosure::reset_skip_compacting(He
   assert(_collector->is_skip_compacting(region_index), "Only call on is_skip_compacting regions");
 
   if (hr->is_humongous()) {
-    oop obj = cast_to_oop(hr->humongous_start_region()->bottom());
-    assert(_collector->mark_bitmap()->is_marked(obj), "must be live");
-  } else {
+    HeapRegion* start_region = hr->humongous_start_region();
+    oop obj = cast_to_oop(start_region->bottom());
+    assert(_collector->mark_bitmap()->is_marked(obj) || start_region->has_pinned_objects(),
+           "must be live or pinned");
+  } else if (!hr->has_pinned_objects()) {
     assert(_collector->live_words(region_index) > _collector->scope()->region_compaction_threshold(),
            "should be quite full");
   }
@@ -31,6 +31,7 @@ class G1FullGCResetMetadataTask : public G1FullGCTask {
   G1FullCollector* _collector;
   HeapRegionClaimer _claimer;
 
+public:
   class G1ResetMetadataClosure : public HeapRegionClosure {
     G1CollectedHeap* _g1h;
     G1FullCollector* _collector;
@@ -43,13 +44,23 @@ class G1FullGCResetMetadataTask : public G1FullGCTask {
 
     void reset_skip_compacting(HeapRegion* r);
 
+    void reset_not_compaction_target(HeapRegion* hr);
+
   public:
     G1ResetMetadataClosure(G1FullCollector* collector);
 
+    // Returns whether the metadata of the given region can be reset while
+    // compaction is still in progress, i.e. the region is not affected by
+    // compaction at all.
+    bool can_reset_during_compaction(HeapRegion* hr) const;
+    // Reset the given region while compaction is still in progress. The
+    // region will be skipped when resetting metadata after compaction.
+    void reset_during_compaction(HeapRegion* hr);
+
     bool do_heap_region(HeapRegion* hr);
   };
 
-public:
+
   G1FullGCResetMetadataTask(G1FullCollector* collector) :
     G1FullGCTask("G1 Reset Metadata Task", collector),
     _collector(collector),
@@ -126,7 +126,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     ScanHRClaimedChunks,
     ScanHRFoundRoots,
     ScanHRScannedOptRefs,
-    ScanHRUsedMemory
+    ScanHRUsedMemory,
+    ScanHRNodeLocalChunks
   };
 
   enum GCMergeLBWorkItems {
@@ -138,7 +139,9 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     MergePSSCopiedBytes,
     MergePSSLABSize,
     MergePSSLABWasteBytes,
-    MergePSSLABUndoWasteBytes
+    MergePSSLABUndoWasteBytes,
+    MergePSSLABRefills,
+    MergePSSDirectAllocations
   };
 
   enum RestoreRetainedRegionsWorkItems {
@@ -234,14 +237,14 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   double print_merge_heap_roots_time() const;
   double print_evacuate_initial_collection_set() const;
   double print_evacuate_optional_collection_set() const;
-  double print_post_evacuate_collection_set(bool evacuation_failed) const;
+  double print_post_evacuate_collection_set(bool evacuation_retained) const;
   void print_other(double accounted_ms) const;
 
  public:
   G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads);
   void record_gc_pause_start();
   void record_gc_pause_end();
-  void print(bool evacuation_failed);
+  void print(bool evacuation_retained);
   static const char* phase_name(GCParPhases phase);
 
   // record the time a phase took in seconds
@@ -36,10 +36,13 @@ public:
   // remset_is_tracked_t is essentially bool, but we need precise control
   // on the size, and sizeof(bool) is implementation specific.
   typedef uint8_t remset_is_tracked_t;
+  // Same as remset_is_tracked_t for the is_pinned attribute.
+  typedef uint8_t is_pinned_t;
 
 private:
   remset_is_tracked_t _remset_is_tracked;
   region_type_t _type;
+  is_pinned_t _is_pinned;
 
 public:
   // Selection of the values for the _type field were driven to micro-optimize the
@@ -59,8 +62,8 @@ public:
   static const region_type_t Old          =   1;    // The region is in the collection set and an old region.
   static const region_type_t Num          =   2;
 
-  G1HeapRegionAttr(region_type_t type = NotInCSet, bool remset_is_tracked = false) :
-    _remset_is_tracked(remset_is_tracked), _type(type) {
+  G1HeapRegionAttr(region_type_t type = NotInCSet, bool remset_is_tracked = false, bool is_pinned = false) :
+    _remset_is_tracked(remset_is_tracked), _type(type), _is_pinned(is_pinned) {
 
     assert(is_valid(), "Invalid type %d", _type);
   }
@@ -80,6 +83,10 @@ public:
   }
 
   bool remset_is_tracked() const     { return _remset_is_tracked != 0; }
+  // Whether the region had pinned objects when it was added to the collection
+  // set. Objects can not be pinned during a pause, so this stays accurate until
+  // the end of the evacuation.
+  bool is_pinned() const               { return _is_pinned != 0; }
 
   void set_new_survivor()              { _type = NewSurvivor; }
   void set_old()                       { _type = Old; }
@@ -88,6 +95,7 @@ public:
     _type = NotInCSet;
   }
   void set_remset_is_tracked(bool value)      { _remset_is_tracked = value ? 1 : 0; }
+  void set_is_pinned(bool value)       { _is_pinned = value ? 1 : 0; }
 
   bool is_in_cset_or_humongous_candidate() const { return is_in_cset() || is_humongous_candidate(); }
   bool is_in_cset() const              { return type() >= Young; }
@@ -149,16 +157,16 @@ class G1HeapRegionAttrBiasedMappedArray : public G1BiasedMappedArray<G1HeapRegio
     get_ref_by_index(index)->set_remset_is_tracked(remset_is_tracked);
   }
 
-  void set_in_young(uintptr_t index) {
+  void set_in_young(uintptr_t index, bool is_pinned) {
     assert(get_by_index(index).is_default(),
            "Region attributes at index " INTPTR_FORMAT " should be default but is %s", index, get_by_index(index).get_type_str());
-    set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Young, true));
+    set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Young, true, is_pinned));
   }
 
-  void set_in_old(uintptr_t index, bool remset_is_tracked) {
+  void set_in_old(uintptr_t index, bool remset_is_tracked, bool is_pinned) {
     assert(get_by_index(index).is_default(),
            "Region attributes at index " INTPTR_FORMAT " should be default but is %s", index, get_by_index(index).get_type_str());
-    set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Old, remset_is_tracked));
+    set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Old, remset_is_tracked, is_pinned));
   }
 
   bool is_in_cset_or_humongous_candidate(HeapWord* addr) const { return at(addr).is_in_cset_or_humongous_candidate(); }
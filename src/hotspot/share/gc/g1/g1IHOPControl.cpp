@@ -128,6 +128,11 @@ size_t G1AdaptiveIHOPControl::get_conc_mark_start_threshold() {
   if (have_enough_data_for_prediction()) {
     double pred_marking_time = predict(&_marking_times_s);
     double pred_promotion_rate = predict(&_allocation_rate_s);
+    if (G1AdaptiveIHOPUsePeakAllocationRate) {
+      // The decaying average reacts slowly to bursts; the window of recent
+      // samples still holds them.
+      pred_promotion_rate = MAX2(pred_promotion_rate, _allocation_rate_s.maximum());
+    }
     size_t pred_promotion_size = (size_t)(pred_marking_time * pred_promotion_rate);
 
     size_t predicted_needed_bytes_during_marking =
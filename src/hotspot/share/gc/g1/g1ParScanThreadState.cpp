@@ -75,6 +75,10 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _stack_trim_upper_threshold(GCDrainStackTargetSize * 2 + 1),
     _stack_trim_lower_threshold(GCDrainStackTargetSize),
     _trim_ticks(),
+    _prefetch_window(),
+    _prefetch_window_head(0),
+    _prefetch_window_length(0),
+    _prefetch_distance(G1EvacuationPrefetchDistance),
     _surviving_young_words_base(nullptr),
     _surviving_young_words(nullptr),
     _surviving_words_length(collection_set->young_region_length() + 1),
@@ -90,6 +94,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _evacuation_failed_info(),
     _evac_failure_regions(evac_failure_regions)
 {
+  assert(_prefetch_distance <= PrefetchWindowCapacity, "prefetch distance %u too large", _prefetch_distance);
+
   // We allocate number of young gen regions in the collection set plus one
   // entries, since entry 0 keeps track of surviving bytes for non-young regions.
   // We also add a few elements at the beginning and at the end in
@@ -147,6 +153,14 @@ size_t G1ParScanThreadState::lab_undo_waste_words() const {
   return _plab_allocator->undo_waste();
 }
 
+size_t G1ParScanThreadState::lab_refills() const {
+  return _plab_allocator->num_plab_fills();
+}
+
+size_t G1ParScanThreadState::direct_allocations() const {
+  return _plab_allocator->num_direct_allocations();
+}
+
 #ifdef ASSERT
 void G1ParScanThreadState::verify_task(narrowOop* task) const {
   assert(task != nullptr, "invariant");
@@ -295,22 +309,82 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task) {
   }
 }
 
+inline void G1ParScanThreadState::prefetch_task(ScannerTask task) const {
+  oop obj;
+  if (task.is_narrow_oop_ptr()) {
+    obj = CompressedOops::decode(RawAccess<>::oop_load(task.to_narrow_oop_ptr()));
+  } else if (task.is_oop_ptr()) {
+    obj = RawAccess<>::oop_load(task.to_oop_ptr());
+  } else {
+    obj = task.to_partial_array_task().to_source_array();
+  }
+  // Header and klass of the object are needed first when processing the task.
+  Prefetch::read(cast_from_oop<HeapWord*>(obj), 0);
+}
+
+MAYBE_INLINE_EVACUATION
+void G1ParScanThreadState::dispatch_task_with_prefetch(ScannerTask task) {
+  prefetch_task(task);
+  if (_prefetch_window_length == _prefetch_distance) {
+    ScannerTask oldest = _prefetch_window[_prefetch_window_head];
+    _prefetch_window[_prefetch_window_head] = task;
+    _prefetch_window_head = next_prefetch_window_index(_prefetch_window_head);
+    dispatch_task(oldest);
+  } else {
+    uint tail = _prefetch_window_head + _prefetch_window_length;
+    if (tail >= _prefetch_distance) {
+      tail -= _prefetch_distance;
+    }
+    _prefetch_window[tail] = task;
+    _prefetch_window_length++;
+  }
+}
+
+void G1ParScanThreadState::drain_prefetch_window() {
+  while (_prefetch_window_length > 0) {
+    ScannerTask task = _prefetch_window[_prefetch_window_head];
+    _prefetch_window_head = next_prefetch_window_index(_prefetch_window_head);
+    _prefetch_window_length--;
+    dispatch_task(task);
+  }
+  _prefetch_window_head = 0;
+}
+
 // Process tasks until overflow queue is empty and local queue
 // contains no more than threshold entries.  NOINLINE to prevent
 // inlining into steal_and_trim_queue.
 ATTRIBUTE_FLATTEN NOINLINE
 void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
   ScannerTask task;
+  if (_prefetch_distance == 0) {
+    do {
+      while (_task_queue->pop_overflow(task)) {
+        if (!_task_queue->try_push_to_taskqueue(task)) {
+          dispatch_task(task);
+        }
+      }
+      while (_task_queue->pop_local(task, threshold)) {
+        dispatch_task(task);
+      }
+    } while (!_task_queue->overflow_empty());
+    return;
+  }
+
+  // Same as above, but delay processing of popped tasks by the prefetch
+  // distance so that the prefetches for their referents have time to complete.
+  // Processing of the remaining tasks in the window may push new tasks, so
+  // retry until no work is left.
   do {
     while (_task_queue->pop_overflow(task)) {
       if (!_task_queue->try_push_to_taskqueue(task)) {
-        dispatch_task(task);
+        dispatch_task_with_prefetch(task);
       }
     }
     while (_task_queue->pop_local(task, threshold)) {
-      dispatch_task(task);
+      dispatch_task_with_prefetch(task);
     }
-  } while (!_task_queue->overflow_empty());
+    drain_prefetch_window();
+  } while (!_task_queue->overflow_empty() || _task_queue->size() > threshold);
 }
 
 ATTRIBUTE_FLATTEN
@@ -458,7 +532,13 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
 
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
+  // Objects in regions with pinned objects must stay in place.
+  if (region_attr.is_pinned()) {
+    return handle_evacuation_failure_par(old, old_mark, word_sz, true /* cause_pinned */);
+  }
+
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
+
   uint node_index = from_region->node_index();
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
@@ -594,11 +674,15 @@ void G1ParScanThreadStateSet::flush_stats() {
     // because it resets the PLAB allocator where we get this info from.
     size_t lab_waste_bytes = pss->lab_waste_words() * HeapWordSize;
     size_t lab_undo_waste_bytes = pss->lab_undo_waste_words() * HeapWordSize;
+    size_t lab_refills = pss->lab_refills();
+    size_t direct_allocations = pss->direct_allocations();
     size_t copied_bytes = pss->flush_stats(_surviving_young_words_total, _num_workers) * HeapWordSize;
 
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, copied_bytes, G1GCPhaseTimes::MergePSSCopiedBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_waste_bytes, G1GCPhaseTimes::MergePSSLABWasteBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_undo_waste_bytes, G1GCPhaseTimes::MergePSSLABUndoWasteBytes);
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_refills, G1GCPhaseTimes::MergePSSLABRefills);
+    p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, direct_allocations, G1GCPhaseTimes::MergePSSDirectAllocations);
 
     delete pss;
     _states[worker_id] = nullptr;
@@ -617,7 +701,7 @@ void G1ParScanThreadStateSet::record_unused_optional_region(HeapRegion* hr) {
 }
 
 NOINLINE
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz) {
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, size_t word_sz, bool cause_pinned) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, m, memory_order_relaxed);
@@ -625,7 +709,7 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
     // Forward-to-self succeeded. We are the "owner" of the object.
     HeapRegion* r = _g1h->heap_region_containing(old);
 
-    if (_evac_failure_regions->record(r->hrm_index())) {
+    if (_evac_failure_regions->record(r->hrm_index(), cause_pinned)) {
       _g1h->hr_printer()->evac_failure(r);
     }
 
@@ -637,7 +721,9 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
 
     ContinuationGCSupport::transform_stack_chunk(old);
 
-    _evacuation_failed_info.register_copy_failure(word_sz);
+    if (!cause_pinned) {
+      _evacuation_failed_info.register_copy_failure(word_sz);
+    }
 
     // For iterating objects that failed evacuation currently we can reuse the
     // existing closure to scan evacuated objects because:
@@ -76,6 +76,16 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   uint const _stack_trim_lower_threshold;
 
   Tickspan _trim_ticks;
+
+  // Tasks popped from the task queue whose referents have already been
+  // prefetched into the cache, but that have not been processed yet. The
+  // number of tasks kept is the prefetch distance.
+  static const uint PrefetchWindowCapacity = 16;
+  ScannerTask _prefetch_window[PrefetchWindowCapacity];
+  uint _prefetch_window_head;
+  uint _prefetch_window_length;
+  uint const _prefetch_distance;
+
   // Map from young-age-index (0 == not young, 1 is youngest) to
   // surviving words. base is what we get back from the malloc call
   size_t* _surviving_young_words_base;
@@ -151,6 +161,8 @@ public:
 
   size_t lab_waste_words() const;
   size_t lab_undo_waste_words() const;
+  size_t lab_refills() const;
+  size_t direct_allocations() const;
 
   // Pass locally gathered statistics to global state. Returns the total number of
   // HeapWords copied.
@@ -182,6 +194,17 @@ private:
 
   void dispatch_task(ScannerTask task);
 
+  // Issue a prefetch for the object the given task refers to.
+  inline void prefetch_task(ScannerTask task) const;
+  // Add the task to the prefetch window and process the oldest task in it if
+  // the window is full.
+  inline void dispatch_task_with_prefetch(ScannerTask task);
+  // Process all tasks in the prefetch window.
+  void drain_prefetch_window();
+  uint next_prefetch_window_index(uint i) const {
+    return (i + 1 == _prefetch_distance) ? 0 : i + 1;
+  }
+
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. Previous_plab_refill_failed indicates whether previous
   // PLAB refill for the original (source) object failed.
@@ -218,8 +241,9 @@ public:
   Tickspan trim_ticks() const;
   void reset_trim_ticks();
 
-  // An attempt to evacuate "obj" has failed; take necessary steps.
-  oop handle_evacuation_failure_par(oop obj, markWord m, size_t word_sz);
+  // An attempt to evacuate "obj" has failed; take necessary steps. If cause_pinned
+  // is true, the object must not be evacuated because its region is pinned.
+  oop handle_evacuation_failure_par(oop obj, markWord m, size_t word_sz, bool cause_pinned = false);
 
   template <typename T>
   inline void remember_root_into_optional_region(T* p);
@@ -79,6 +79,8 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _phase_times(nullptr),
   _mark_remark_start_sec(0),
   _mark_cleanup_start_sec(0),
+  _predicted_evacuation_time_ms(0.0),
+  _evacuation_time_ratio(1.0),
   _tenuring_threshold(MaxTenuringThreshold),
   _max_survivor_regions(0),
   _survivors_age_table(true)
@@ -637,6 +639,9 @@ void G1Policy::record_young_collection_start() {
 
   phase_times()->record_cur_collection_start_sec(now.seconds());
 
+  _predicted_evacuation_time_ms = 0.0;
+  _evacuation_time_ratio = 1.0;
+
   // do that for any other surv rate groups
   _eden_surv_rate_group->stop_adding_regions();
   _survivors_age_table.clear();
@@ -988,9 +993,9 @@ void G1Policy::report_ihop_statistics() {
   _ihop_control->print();
 }
 
-void G1Policy::record_young_gc_pause_end(bool evacuation_failed) {
+void G1Policy::record_young_gc_pause_end(bool evacuation_retained) {
   phase_times()->record_gc_pause_end();
-  phase_times()->print(evacuation_failed);
+  phase_times()->print(evacuation_retained);
 }
 
 double G1Policy::predict_base_time_ms(size_t pending_cards,
@@ -1408,6 +1413,7 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
   assert(marking_list != nullptr, "must be");
 
   uint num_expensive_regions = 0;
+  uint num_pinned_regions = 0;
 
   uint num_initial_regions_selected = 0;
   uint num_optional_regions_selected = 0;
@@ -1435,6 +1441,12 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
       break;
     }
     HeapRegion* hr = *iter;
+    if (hr->has_pinned_objects()) {
+      // Regions with pinned objects can not be evacuated; keep them as
+      // candidates for a later collection.
+      num_pinned_regions++;
+      continue;
+    }
     double predicted_time_ms = predict_region_total_time_ms(hr, false);
     time_remaining_ms = MAX2(time_remaining_ms - predicted_time_ms, 0.0);
     // Add regions to old set until we reach the minimum amount
@@ -1478,6 +1490,10 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
                               num_expensive_regions);
   }
 
+  if (num_pinned_regions > 0) {
+    log_debug(gc, ergo, cset)("Skipped %u marking candidates with pinned objects.", num_pinned_regions);
+  }
+
   log_debug(gc, ergo, cset)("Finish adding marking candidates to collection set. Initial: %u, optional: %u, "
                             "predicted initial time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2fms",
                             num_initial_regions_selected, num_optional_regions_selected,
@@ -1485,6 +1501,8 @@ double G1Policy::select_candidates_from_marking(G1CollectionCandidateList* marki
 
   assert(initial_old_regions->length() == num_initial_regions_selected, "must be");
   assert(optional_old_regions->length() == num_optional_regions_selected, "must be");
+
+  add_predicted_evacuation_time_ms(predicted_initial_time_ms);
   return time_remaining_ms;
 }
 
@@ -1496,8 +1514,10 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionCandidateRe
 
   double total_prediction_ms = 0.0;
 
+  update_evacuation_time_ratio();
+
   for (HeapRegion* r : *optional_regions) {
-    double prediction_ms = predict_region_total_time_ms(r, false);
+    double prediction_ms = predict_region_total_time_ms(r, false) * _evacuation_time_ratio;
 
     if (prediction_ms > time_remaining_ms) {
       log_debug(gc, ergo, cset)("Prediction %.3fms for region %u does not fit remaining time: %.3fms.",
@@ -1512,10 +1532,34 @@ void G1Policy::calculate_optional_collection_set_regions(G1CollectionCandidateRe
     selected_regions->append(r);
   }
 
+  // Keep the uncorrected prediction to compare against actual times later.
+  add_predicted_evacuation_time_ms(total_prediction_ms / _evacuation_time_ratio);
+
   log_debug(gc, ergo, cset)("Prepared %u regions out of %u for optional evacuation. Total predicted time: %.3fms",
                             selected_regions->length(), optional_regions->length(), total_prediction_ms);
 }
 
+void G1Policy::update_evacuation_time_ratio() {
+  if (!G1UseEvacuationTimeFeedback) {
+    return;
+  }
+  // Below this predicted time the ratio is too noisy to be useful.
+  const double MinPredictedTimeMs = 1.0;
+  // Limits for the correction of predictions.
+  const double MinRatio = 0.25;
+  const double MaxRatio = 4.0;
+
+  if (_predicted_evacuation_time_ms < MinPredictedTimeMs) {
+    return;
+  }
+
+  double actual_time_ms = phase_times()->cur_collection_par_time_ms();
+  _evacuation_time_ratio = clamp(actual_time_ms / _predicted_evacuation_time_ms, MinRatio, MaxRatio);
+
+  log_debug(gc, ergo, cset)("Evacuation time so far: actual %.3fms predicted %.3fms ratio %.3f",
+                            actual_time_ms, _predicted_evacuation_time_ms, _evacuation_time_ratio);
+}
+
 void G1Policy::transfer_survivors_to_cset(const G1SurvivorRegions* survivors) {
   start_adding_survivor_regions();
 
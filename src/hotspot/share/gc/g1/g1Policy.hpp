@@ -206,6 +206,17 @@ private:
   double _mark_remark_start_sec;
   double _mark_cleanup_start_sec;
 
+  // Evacuation time feedback for optional regions (G1UseEvacuationTimeFeedback).
+  // Sum of the predicted times of all evacuation phases in the current pause.
+  double _predicted_evacuation_time_ms;
+  // Ratio between actual and predicted evacuation time observed in the current
+  // pause so far, used to correct predictions for optional regions.
+  double _evacuation_time_ratio;
+
+  // Update _evacuation_time_ratio with the evacuation time of the current
+  // pause so far.
+  void update_evacuation_time_ratio();
+
   // Updates the internal young gen maximum and target and desired lengths.
   // If no parameters are passed, predict pending cards and the RS length using
   // the prediction model.
@@ -307,7 +318,9 @@ public:
 
   // Record the start and end of the young gc pause.
   void record_young_gc_pause_start();
-  void record_young_gc_pause_end(bool evacuation_failed);
+  // evacuation_retained indicates whether any region has been retained in
+  // place, due to allocation failure or pinning.
+  void record_young_gc_pause_end(bool evacuation_retained);
 
   bool need_to_start_conc_mark(const char* source, size_t alloc_word_size = 0);
 
@@ -346,6 +359,11 @@ public:
                                         G1CollectionCandidateRegionList* initial_old_regions,
                                         G1CollectionCandidateRegionList* optional_old_regions);
 
+  // Record the predicted time for evacuating regions in the current pause.
+  void add_predicted_evacuation_time_ms(double time_ms) {
+    _predicted_evacuation_time_ms += time_ms;
+  }
+
   // Calculate the number of optional regions from the given collection set candidates,
   // the remaining time and the maximum number of these regions and return the number
   // of actually selected regions in num_optional_regions.
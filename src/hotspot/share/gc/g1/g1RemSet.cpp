@@ -35,6 +35,7 @@
 #include "gc/g1/g1FromCardCache.hpp"
 #include "gc/g1/g1GCParPhaseTimesTracker.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1RootClosures.hpp"
@@ -134,6 +135,19 @@ private:
   // in the current evacuation pass.
   G1DirtyRegions* _next_dirty_regions;
 
+  // The regions of _next_dirty_regions grouped by the NUMA node their memory
+  // is homed on, so that workers can scan regions on their own node first and
+  // only then help with the regions of other nodes (G1NUMAAwareRemSetScan).
+  // The regions of node i are at [_node_dirty_regions_start[i],
+  // _node_dirty_regions_start[i + 1]). The last bucket contains regions whose
+  // node is unknown. Only allocated if NUMA-aware scanning is enabled.
+  uint* _node_dirty_regions;
+  uint* _node_dirty_regions_start;
+  uint* _node_dirty_regions_cur;
+  uint _num_node_buckets;
+  // Whether _node_dirty_regions reflects the contents of _next_dirty_regions.
+  bool _node_dirty_regions_valid;
+
   // Set of (unique) regions that can be added to concurrently.
   class G1DirtyRegions : public CHeapObj<mtGC> {
     uint* _buffer;
@@ -266,11 +280,19 @@ public:
     _scan_chunks_shift(0),
     _all_dirty_regions(nullptr),
     _next_dirty_regions(nullptr),
+    _node_dirty_regions(nullptr),
+    _node_dirty_regions_start(nullptr),
+    _node_dirty_regions_cur(nullptr),
+    _num_node_buckets(0),
+    _node_dirty_regions_valid(false),
     _scan_top(nullptr) {
   }
 
   ~G1RemSetScanState() {
     FREE_C_HEAP_ARRAY(G1RemsetIterState, _collection_set_iter_state);
+    FREE_C_HEAP_ARRAY(uint, _node_dirty_regions);
+    FREE_C_HEAP_ARRAY(uint, _node_dirty_regions_start);
+    FREE_C_HEAP_ARRAY(uint, _node_dirty_regions_cur);
     FREE_C_HEAP_ARRAY(uint, _card_table_scan_state);
     FREE_C_HEAP_ARRAY(bool, _region_scan_chunks);
     FREE_C_HEAP_ARRAY(HeapWord*, _scan_top);
@@ -286,6 +308,15 @@ public:
 
     _scan_chunks_shift = (uint8_t)log2i(HeapRegion::CardsPerRegion / _scan_chunks_per_region);
     _scan_top = NEW_C_HEAP_ARRAY(HeapWord*, max_reserved_regions, mtGC);
+
+    G1NUMA* numa = G1NUMA::numa();
+    if (G1NUMAAwareRemSetScan && numa->is_enabled()) {
+      // One bucket per active node plus one for regions with unknown node.
+      _num_node_buckets = numa->num_active_nodes() + 1;
+      _node_dirty_regions = NEW_C_HEAP_ARRAY(uint, max_reserved_regions, mtGC);
+      _node_dirty_regions_start = NEW_C_HEAP_ARRAY(uint, _num_node_buckets + 1, mtGC);
+      _node_dirty_regions_cur = NEW_C_HEAP_ARRAY(uint, _num_node_buckets, mtGC);
+    }
   }
 
   void prepare() {
@@ -317,6 +348,41 @@ public:
       _all_dirty_regions->merge(_next_dirty_regions);
     }
     _next_dirty_regions->reset();
+    _node_dirty_regions_valid = false;
+  }
+
+  uint node_bucket_for_region(uint region_idx) const {
+    uint node_index = G1CollectedHeap::heap()->region_at(region_idx)->node_index();
+    // Regions with unknown node go into the last bucket.
+    return MIN2(node_index, _num_node_buckets - 1);
+  }
+
+  // Sorts the regions to scan by node (bucket sort). Must be called after all
+  // dirty regions for the current evacuation phase have been added.
+  void partition_dirty_regions_by_node() {
+    if (_node_dirty_regions == nullptr) {
+      return;
+    }
+
+    uint const num_regions = _next_dirty_regions->size();
+
+    ::memset(_node_dirty_regions_start, 0, (_num_node_buckets + 1) * sizeof(uint));
+    for (uint i = 0; i < num_regions; i++) {
+      _node_dirty_regions_start[node_bucket_for_region(_next_dirty_regions->at(i)) + 1]++;
+    }
+    for (uint i = 0; i < _num_node_buckets; i++) {
+      _node_dirty_regions_start[i + 1] += _node_dirty_regions_start[i];
+      _node_dirty_regions_cur[i] = _node_dirty_regions_start[i];
+    }
+    for (uint i = 0; i < num_regions; i++) {
+      uint const region_idx = _next_dirty_regions->at(i);
+      _node_dirty_regions[_node_dirty_regions_cur[node_bucket_for_region(region_idx)]++] = region_idx;
+    }
+    assert(_node_dirty_regions_start[_num_node_buckets] == num_regions,
+           "Partitioned %u regions but expected %u",
+           _node_dirty_regions_start[_num_node_buckets], num_regions);
+
+    _node_dirty_regions_valid = true;
   }
 
   // Returns whether the given region contains cards we need to scan. The remembered
@@ -374,6 +440,44 @@ public:
     _next_dirty_regions = nullptr;
   }
 
+  // Apply the closure to the regions of the given node bucket, starting at a
+  // worker dependent position to spread workers across that bucket.
+  void iterate_node_dirty_regions_from(HeapRegionClosure* cl, uint bucket, uint worker_id, uint max_workers) {
+    uint const start = _node_dirty_regions_start[bucket];
+    uint const num_regions = _node_dirty_regions_start[bucket + 1] - start;
+
+    if (num_regions == 0) {
+      return;
+    }
+
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+
+    uint const start_pos = num_regions * worker_id / max_workers;
+    uint cur = start_pos;
+
+    do {
+      bool result = cl->do_heap_region(g1h->region_at(_node_dirty_regions[start + cur]));
+      guarantee(!result, "Not allowed to ask for early termination.");
+      cur++;
+      if (cur == num_regions) {
+        cur = 0;
+      }
+    } while (cur != start_pos);
+  }
+
+  // Scan the regions homed on the node of the current worker first. Regions are
+  // claimed in chunks, so after that the worker steals remaining chunks of the
+  // regions of the other nodes, starting with the next one.
+  void iterate_dirty_regions_by_node_from(HeapRegionClosure* cl, uint worker_id, uint max_workers) {
+    uint const node_index = G1NUMA::numa()->index_of_current_thread();
+    uint const local_bucket = MIN2(node_index, _num_node_buckets - 1);
+
+    for (uint i = 0; i < _num_node_buckets; i++) {
+      uint const bucket = (local_bucket + i) % _num_node_buckets;
+      iterate_node_dirty_regions_from(cl, bucket, worker_id, max_workers);
+    }
+  }
+
   void iterate_dirty_regions_from(HeapRegionClosure* cl, uint worker_id) {
     uint num_regions = _next_dirty_regions->size();
 
@@ -386,6 +490,11 @@ public:
     WorkerThreads* workers = g1h->workers();
     uint const max_workers = workers->active_workers();
 
+    if (_node_dirty_regions_valid) {
+      iterate_dirty_regions_by_node_from(cl, worker_id, max_workers);
+      return;
+    }
+
     uint const start_pos = num_regions * worker_id / max_workers;
     uint cur = start_pos;
 
@@ -517,10 +626,14 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   G1GCPhaseTimes::GCParPhases _phase;
 
   uint   _worker_id;
+  // NUMA node of this worker, UnknownNodeIndex if NUMA is not enabled.
+  uint   _node_index;
 
   size_t _cards_scanned;
   size_t _blocks_scanned;
   size_t _chunks_claimed;
+  // Chunks claimed in regions homed on the node of this worker.
+  size_t _node_local_chunks_claimed;
   size_t _heap_roots_found;
 
   Tickspan _rem_set_root_scan_time;
@@ -675,8 +788,13 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
     // to resetting this value for every claim.
     _scanned_to = nullptr;
 
+    bool const node_local = _node_index != G1NUMA::UnknownNodeIndex && r->node_index() == _node_index;
+
     while (claim.has_next()) {
       _chunks_claimed++;
+      if (node_local) {
+        _node_local_chunks_claimed++;
+      }
 
       size_t const region_card_base_idx = ((size_t)region_idx << HeapRegion::LogCardsPerRegion) + claim.value();
 
@@ -702,9 +820,12 @@ public:
     _scan_state(scan_state),
     _phase(phase),
     _worker_id(worker_id),
+    _node_index(G1NUMA::numa()->is_enabled() ? G1NUMA::numa()->index_of_current_thread()
+                                             : G1NUMA::UnknownNodeIndex),
     _cards_scanned(0),
     _blocks_scanned(0),
     _chunks_claimed(0),
+    _node_local_chunks_claimed(0),
     _heap_roots_found(0),
     _rem_set_root_scan_time(),
     _rem_set_trim_partially_time(),
@@ -732,6 +853,7 @@ public:
   size_t cards_scanned() const { return _cards_scanned; }
   size_t blocks_scanned() const { return _blocks_scanned; }
   size_t chunks_claimed() const { return _chunks_claimed; }
+  size_t node_local_chunks_claimed() const { return _node_local_chunks_claimed; }
   size_t heap_roots_found() const { return _heap_roots_found; }
 };
 
@@ -755,6 +877,9 @@ void G1RemSet::scan_heap_roots(G1ParScanThreadState* pss,
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.blocks_scanned(), G1GCPhaseTimes::ScanHRScannedBlocks);
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.chunks_claimed(), G1GCPhaseTimes::ScanHRClaimedChunks);
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.heap_roots_found(), G1GCPhaseTimes::ScanHRFoundRoots);
+  if (G1NUMA::numa()->is_enabled()) {
+    p->record_or_add_thread_work_item(scan_phase, worker_id, cl.node_local_chunks_claimed(), G1GCPhaseTimes::ScanHRNodeLocalChunks);
+  }
 }
 
 // Heap region closure to be applied to all regions in the current collection set
@@ -1398,6 +1523,8 @@ void G1RemSet::merge_heap_roots(bool initial_evacuation) {
     workers->run_task(&cl, num_workers);
   }
 
+  _scan_state->partition_dirty_regions_by_node();
+
   print_merge_heap_roots_stats();
 }
 
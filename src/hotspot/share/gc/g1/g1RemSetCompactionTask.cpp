@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1RemSetCompactionTask.hpp"
+#include "gc/g1/g1_globals.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
+#include "gc/g1/heapRegionRemSet.inline.hpp"
+#include "logging/log.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+
+class G1StaleCardRegionFilter : public G1CardSet::CardRegionFilter {
+  G1CollectedHeap* _g1h;
+
+public:
+  explicit G1StaleCardRegionFilter(G1CollectedHeap* g1h) : _g1h(g1h) { }
+
+  bool is_stale(uint region_idx) override {
+    HeapRegion* r = _g1h->region_at_or_null(region_idx);
+    // Uncommitted, free and young regions never add entries to remembered
+    // sets; any cards of them have been added before the region has been
+    // freed.
+    return r == nullptr || r->is_free() || r->is_young();
+  }
+};
+
+G1RemSetCompactionTask::G1RemSetCompactionTask(const char* name) :
+  G1ServiceTask(name),
+  _cur_region(0),
+  _gc_count_at_pass_start(0),
+  _gc_count_at_last_pass(0),
+  _num_removed_containers(0) { }
+
+bool G1RemSetCompactionTask::compact_step() {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+
+  // Blocks garbage collections and humongous allocations while we are
+  // removing entries.
+  MutexLocker ml(Heap_lock);
+
+  uint const gc_count = g1h->total_collections();
+  if (_cur_region == 0) {
+    if (gc_count == _gc_count_at_last_pass) {
+      // Nothing could have become stale since the last pass.
+      return false;
+    }
+    _gc_count_at_pass_start = gc_count;
+    _num_removed_containers = 0;
+  }
+  // Staleness is checked against the current heap state in every step, so
+  // a pass continues where it stopped after a garbage collection. Regions
+  // already processed in this pass are covered again by the next pass, as
+  // the collection count differs from the one at the start of this pass.
+
+  jlong const deadline = os::elapsed_counter() +
+                         (jlong)((os::elapsed_frequency() / 1000) * G1RemSetFreeMemoryStepDurationMillis);
+
+  G1StaleCardRegionFilter filter(g1h);
+  uint const max_regions = g1h->max_reserved_regions();
+  while (_cur_region < max_regions) {
+    HeapRegion* r = g1h->region_at_or_null(_cur_region++);
+    if (r != nullptr && r->is_old_or_humongous() && r->rem_set()->is_tracked()) {
+      _num_removed_containers += r->rem_set()->remove_stale_cards(&filter);
+    }
+    if (os::elapsed_counter() >= deadline) {
+      break;
+    }
+  }
+
+  if (_cur_region < max_regions) {
+    return true;
+  }
+
+  log_debug(gc, remset)("Remembered set compaction removed %zu stale containers", _num_removed_containers);
+  _gc_count_at_last_pass = _gc_count_at_pass_start;
+  _cur_region = 0;
+  return false;
+}
+
+void G1RemSetCompactionTask::execute() {
+  if (G1RemSetCompactionInterval == 0) {
+    // Disabled; check again later whether it has been enabled.
+    schedule(1000);
+    return;
+  }
+
+  if (compact_step()) {
+    schedule(G1RemSetFreeMemoryRescheduleDelayMillis);
+  } else {
+    schedule(G1RemSetCompactionInterval);
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1REMSETCOMPACTIONTASK_HPP
+#define SHARE_GC_G1_G1REMSETCOMPACTIONTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+
+// Task removing stale entries from the remembered sets of old regions.
+//
+// Remembered sets are only ever added to, so once the regions referencing a
+// region have been freed, their card set containers stay around until the
+// remembered set is cleared. This task removes the containers of freed (or
+// since re-used as young) regions, which makes the memory available for
+// reuse and reduces the amount of cards to merge and scan during evacuation.
+//
+// The task works in steps of limited duration while holding the Heap_lock.
+// This prevents garbage collections and humongous allocations, the only ways
+// a free region could start generating remembered set entries again.
+class G1RemSetCompactionTask : public G1ServiceTask {
+  // Next region to process.
+  uint _cur_region;
+  // Number of collections when the current pass started.
+  uint _gc_count_at_pass_start;
+  // Number of collections when the last completed pass started.
+  uint _gc_count_at_last_pass;
+
+  size_t _num_removed_containers;
+
+  // Processes regions until all have been processed or the step duration has
+  // been exceeded. Returns true if there is remaining work.
+  bool compact_step();
+
+public:
+  explicit G1RemSetCompactionTask(const char* name);
+
+  void execute() override;
+};
+
+#endif // SHARE_GC_G1_G1REMSETCOMPACTIONTASK_HPP
@@ -34,6 +34,7 @@
 #include "gc/g1/g1ConcurrentMark.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1YoungGCEvacFailureInjector.hpp"
+#include "gc/g1/g1EvacFailureRegions.inline.hpp"
 #include "gc/g1/g1EvacInfo.hpp"
 #include "gc/g1/g1HRPrinter.hpp"
 #include "gc/g1/g1MonitoringSupport.hpp"
@@ -112,7 +113,8 @@ public:
   }
 
   ~G1YoungGCNotifyPauseMark() {
-    G1CollectedHeap::heap()->policy()->record_young_gc_pause_end(_collector->evacuation_failed());
+    G1CollectedHeap::heap()->policy()->record_young_gc_pause_end(_collector->evacuation_failed() ||
+                                                                 _collector->evacuation_pinned());
   }
 };
 
@@ -279,6 +281,27 @@ void G1YoungCollector::calculate_collection_set(G1EvacInfo* evacuation_info, dou
   }
 }
 
+// Record all regions in the collection set that contain pinned objects as
+// retained before evacuation. Their objects can not be moved, and the pinned
+// memory must stay valid even if no object in the region turns out to be live,
+// e.g. after string deduplication replaced the value array of a String.
+class G1RecordPinnedRegionsClosure : public HeapRegionClosure {
+  G1HRPrinter* _hr_printer;
+  G1EvacFailureRegions* _evac_failure_regions;
+
+public:
+  G1RecordPinnedRegionsClosure(G1HRPrinter* hr_printer, G1EvacFailureRegions* evac_failure_regions) :
+    HeapRegionClosure(), _hr_printer(hr_printer), _evac_failure_regions(evac_failure_regions) { }
+
+  virtual bool do_heap_region(HeapRegion* r) {
+    if (r->has_pinned_objects() &&
+        _evac_failure_regions->record(r->hrm_index(), true /* cause_pinned */)) {
+      _hr_printer->evac_failure(r);
+    }
+    return false;
+  }
+};
+
 class G1PrepareEvacuationTask : public WorkerTask {
   class G1PrepareRegionsClosure : public HeapRegionClosure {
     G1CollectedHeap* _g1h;
@@ -313,6 +336,10 @@ class G1PrepareEvacuationTask : public WorkerTask {
       if (!region->rem_set()->is_complete()) {
         return false;
       }
+      // Pinned objects must not be reclaimed.
+      if (region->has_pinned_objects()) {
+        return false;
+      }
       // Candidate selection must satisfy the following constraints
       // while concurrent marking is in progress:
       //
@@ -481,6 +508,11 @@ void G1YoungCollector::pre_evacuate_collection_set(G1EvacInfo* evacuation_info)
 
   _evac_failure_regions.pre_collection(_g1h->max_reserved_regions());
 
+  {
+    G1RecordPinnedRegionsClosure cl(hr_printer(), &_evac_failure_regions);
+    collection_set()->iterate(&cl);
+  }
+
   _g1h->gc_prologue(false);
 
   // Initialize the GC alloc regions.
@@ -990,7 +1022,11 @@ void G1YoungCollector::post_evacuate_collection_set(G1EvacInfo* evacuation_info,
 }
 
 bool G1YoungCollector::evacuation_failed() const {
-  return _evac_failure_regions.evacuation_failed();
+  return _evac_failure_regions.has_regions_alloc_failed();
+}
+
+bool G1YoungCollector::evacuation_pinned() const {
+  return _evac_failure_regions.has_regions_evac_pinned();
 }
 
 G1YoungCollector::G1YoungCollector(GCCause::Cause gc_cause) :
@@ -129,8 +129,12 @@ class G1YoungCollector {
   void post_evacuate_collection_set(G1EvacInfo* evacuation_info,
                                     G1ParScanThreadStateSet* per_thread_states);
 
-  // True iff an evacuation has failed in the most-recent collection.
+  // True iff an evacuation has failed in the most-recent collection because
+  // an object could not be copied.
   bool evacuation_failed() const;
+  // True iff regions have been retained in the most-recent collection because
+  // they contain pinned objects.
+  bool evacuation_pinned() const;
 
 public:
   G1YoungCollector(GCCause::Cause gc_cause);
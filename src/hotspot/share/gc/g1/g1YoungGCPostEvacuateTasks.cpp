@@ -104,7 +104,7 @@ public:
   }
 
   double worker_cost() const override {
-    assert(_evac_failure_regions->evacuation_failed(), "Should not call this if not executed");
+    assert(_evac_failure_regions->has_regions_evac_failed(), "Should not call this if not executed");
 
     double workers_per_region = (double)G1CollectedHeap::get_chunks_per_region() / G1RestoreRetainedRegionChunksPerWorker;
     return workers_per_region * _evac_failure_regions->num_regions_failed_evacuation();
@@ -119,7 +119,7 @@ G1PostEvacuateCollectionSetCleanupTask1::G1PostEvacuateCollectionSetCleanupTask1
                                                                                  G1EvacFailureRegions* evac_failure_regions) :
   G1BatchedTask("Post Evacuate Cleanup 1", G1CollectedHeap::heap()->phase_times())
 {
-  bool evacuation_failed = evac_failure_regions->evacuation_failed();
+  bool evacuation_failed = evac_failure_regions->has_regions_evac_failed();
 
   add_serial_task(new MergePssTask(per_thread_states));
   add_serial_task(new RecalculateUsedTask(evacuation_failed));
@@ -724,7 +724,7 @@ G1PostEvacuateCollectionSetCleanupTask2::G1PostEvacuateCollectionSetCleanupTask2
     add_serial_task(new EagerlyReclaimHumongousObjectsTask());
   }
 
-  if (evac_failure_regions->evacuation_failed()) {
+  if (evac_failure_regions->has_regions_evac_failed()) {
     add_parallel_task(new RestorePreservedMarksTask(per_thread_states->preserved_marks_set()));
     // Keep marks on bitmaps in retained regions during concurrent start - they will all be old.
     if (!G1CollectedHeap::heap()->collector_state()->in_concurrent_start_gc()) {
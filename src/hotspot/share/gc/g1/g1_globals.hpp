@@ -113,6 +113,12 @@
           "of the optimal occupancy to start marking.")                     \
           range(1, max_intx)                                                \
                                                                             \
+  product(bool, G1AdaptiveIHOPUsePeakAllocationRate, false, EXPERIMENTAL,   \
+          "Use the highest of the recently sampled old gen allocation "     \
+          "rates if it exceeds the predicted rate when calculating the "    \
+          "adaptive IHOP, so that marking starts earlier when the "         \
+          "allocation rate rises in bursts.")                               \
+                                                                            \
   product(uintx, G1ConfidencePercent, 50,                                   \
           "Confidence level for MMU/pause predictions")                     \
           range(0, 100)                                                     \
@@ -313,6 +319,32 @@
           "percentage of the currently used memory.")                       \
           range(0.0, 1.0)                                                   \
                                                                             \
+  product(uintx, G1RemSetCompactionInterval, 0, MANAGEABLE,                 \
+          "Interval in milliseconds between concurrent passes removing "    \
+          "remembered set entries of freed regions. A value of 0 "          \
+          "disables this.")                                                 \
+                                                                            \
+  product(bool, G1UseEvacuationTimeFeedback, false, EXPERIMENTAL,           \
+          "Correct the predicted time of optional regions during a pause "  \
+          "by the ratio between actual and predicted time of the "          \
+          "evacuation so far.")                                             \
+                                                                            \
+  product(bool, G1PLABCopyRateSizing, false, EXPERIMENTAL,                  \
+          "When boosting the PLAB size during a pause, size it according "  \
+          "to the amount of memory the thread already copied into that "    \
+          "destination instead of only doubling it.")                       \
+                                                                            \
+  product(bool, G1FullGCOverlapResetMetadata, false, EXPERIMENTAL,          \
+          "During G1 full collections, let worker threads that finished "   \
+          "compaction reset the metadata of regions not affected by "       \
+          "compaction while other workers are still compacting.")           \
+                                                                            \
+  product(uint, G1EvacuationPrefetchDistance, 0, EXPERIMENTAL,              \
+          "Number of tasks taken from the evacuation task queue whose "     \
+          "referents are prefetched ahead of processing them. "             \
+          "0 disables this prefetching.")                                   \
+          range(0, 16)                                                      \
+                                                                            \
   product(uint, G1RestoreRetainedRegionChunksPerWorker, 16, DIAGNOSTIC,     \
           "The number of chunks assigned per worker thread for "            \
           "retained region restore purposes.")                              \
@@ -323,6 +355,11 @@
           "related prediction sample. That sample must involve the same or "\
           "more than that number of cards to be used.")                     \
                                                                             \
+  product(bool, G1NUMAAwareRemSetScan, false, EXPERIMENTAL,                 \
+          "When NUMA is enabled, let workers scan the cards of regions "    \
+          "on their own node first before helping with the regions on "     \
+          "other nodes during Scan Heap Roots.")                            \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
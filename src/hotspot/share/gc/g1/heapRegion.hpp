@@ -249,6 +249,11 @@ private:
   // NUMA node.
   uint _node_index;
 
+  // Number of objects in this region that are currently pinned, e.g. by JNI
+  // critical sections. Regions containing pinned objects are never evacuated
+  // or compacted.
+  volatile size_t _pinned_object_count;
+
   void report_region_type_change(G1HeapRegionTraceType::Type to);
 
   template <class Closure, bool in_gc_pause>
@@ -555,6 +560,11 @@ public:
   uint node_index() const { return _node_index; }
   void set_node_index(uint node_index) { _node_index = node_index; }
 
+  inline bool has_pinned_objects() const;
+  inline size_t pinned_count() const;
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+
   // Verify that the entries on the code root list for this
   // region are live and include at least one pointer into this region.
   // Returns whether there has been a failure.
@@ -149,6 +149,23 @@ inline HeapWord* HeapRegion::next_live_in_unparsable(const HeapWord* p, HeapWord
   return next_live_in_unparsable(bitmap, p, limit);
 }
 
+inline size_t HeapRegion::pinned_count() const {
+  return Atomic::load(&_pinned_object_count);
+}
+
+inline bool HeapRegion::has_pinned_objects() const {
+  return pinned_count() > 0;
+}
+
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "Region %u has no pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
 inline bool HeapRegion::is_collection_set_candidate() const {
  return G1CollectedHeap::heap()->is_collection_set_candidate(this);
 }
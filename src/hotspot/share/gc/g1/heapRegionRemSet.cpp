@@ -83,6 +83,16 @@ void HeapRegionRemSet::clear_locked(bool only_cardset) {
   assert(occupied() == 0, "Should be clear.");
 }
 
+size_t HeapRegionRemSet::remove_stale_cards(G1CardSet::CardRegionFilter* filter) {
+  MutexLocker x(&_m, Mutex::_no_safepoint_check_flag);
+  size_t num_removed = _card_set.remove_stale_containers(filter);
+  if (num_removed > 0) {
+    // The from card cache might still refer to cards of removed containers.
+    clear_fcc();
+  }
+  return num_removed;
+}
+
 void HeapRegionRemSet::reset_table_scanner() {
   _card_set.reset_table_scanner();
 }
@@ -122,6 +122,11 @@ public:
 
   void reset_table_scanner();
 
+  // Removes the cards of regions that can not contain references into this
+  // region any more, as determined by the filter. Returns the number of
+  // removed card set containers.
+  size_t remove_stale_cards(G1CardSet::CardRegionFilter* filter);
+
   G1MonotonicArenaMemoryStats card_set_memory_stats() const;
 
   // The actual # of bytes this hr_remset takes up. Also includes the code
@@ -56,7 +56,16 @@
           range(0, 100)                                                     \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, UseNUMAPromotion, false, EXPERIMENTAL,                      \
+          "Carve old generation promotion LABs from chunks bound to the "   \
+          "NUMA node of the promoting GC worker. Requires UseNUMA")         \
+                                                                            \
+  product(size_t, NUMAPromotionChunkSize, 2*M, EXPERIMENTAL,                \
+          "Size in bytes of the per-node old generation chunks used "       \
+          "with UseNUMAPromotion")                                          \
+          range(64*K, 64*M)
 
 // end of GC_PARALLEL_FLAGS
 
@@ -35,12 +35,15 @@
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 
 PSOldGen::PSOldGen(ReservedSpace rs, size_t initial_size, size_t min_size,
                    size_t max_size, const char* perf_data_name, int level):
   _min_gen_size(min_size),
-  _max_gen_size(max_size)
+  _max_gen_size(max_size),
+  _numa_chunks(nullptr),
+  _num_numa_chunks(0)
 {
   initialize(rs, initial_size, GenAlignment, perf_data_name, level);
 }
@@ -49,6 +52,7 @@ void PSOldGen::initialize(ReservedSpace rs, size_t initial_size, size_t alignmen
                           const char* perf_data_name, int level) {
   initialize_virtual_space(rs, initial_size, alignment);
   initialize_work(perf_data_name, level);
+  initialize_numa_chunks();
 
   initialize_performance_counters(perf_data_name, level);
 }
@@ -121,6 +125,115 @@ void PSOldGen::initialize_performance_counters(const char* perf_data_name, int l
                                       _object_space, _gen_counters);
 }
 
+void PSOldGen::initialize_numa_chunks() {
+  if (!UseNUMA || !UseNUMAPromotion) {
+    return;
+  }
+  size_t lgrp_limit = os::numa_get_groups_num();
+  int* lgrp_ids = NEW_C_HEAP_ARRAY(int, lgrp_limit, mtGC);
+  uint lgrp_num = (uint)os::numa_get_leaf_groups(lgrp_ids, lgrp_limit);
+  if (lgrp_num > 1) {
+    _numa_chunks = NEW_C_HEAP_ARRAY(NUMAChunk*, lgrp_num, mtGC);
+    for (uint i = 0; i < lgrp_num; i++) {
+      _numa_chunks[i] = new NUMAChunk(lgrp_ids[i]);
+    }
+    _num_numa_chunks = lgrp_num;
+    log_debug(gc, heap)("NUMA promotion: %u nodes, chunk size " SIZE_FORMAT "K",
+                        lgrp_num, NUMAPromotionChunkSize / K);
+  }
+  FREE_C_HEAP_ARRAY(int, lgrp_ids);
+}
+
+PSOldGen::NUMAChunk* PSOldGen::numa_chunk_for_current_thread() {
+  Thread* thr = Thread::current();
+  int lgrp_id = thr->lgrp_id();
+  if (lgrp_id == -1 || !os::numa_has_group_homing()) {
+    lgrp_id = os::numa_get_group_id();
+    thr->set_lgrp_id(lgrp_id);
+  }
+  for (uint i = 0; i < _num_numa_chunks; i++) {
+    if (_numa_chunks[i]->lgrp_id() == lgrp_id) {
+      return _numa_chunks[i];
+    }
+  }
+  // The thread runs on a node that was not known at startup.
+  return nullptr;
+}
+
+// The old gen uses interleaved pages with UseNUMA. Free the pages of the
+// chunk, which contains no objects yet, and bind them to the node so that
+// the first touch by the promoting worker places them there.
+void PSOldGen::bias_numa_chunk(MemRegion mr, int lgrp_id) {
+  const size_t page_size = UseLargePages ? os::large_page_size() : os::vm_page_size();
+  HeapWord* start = align_up(mr.start(), page_size);
+  HeapWord* end = align_down(mr.end(), page_size);
+  if (end > start) {
+    const size_t bytes = pointer_delta(end, start, sizeof(char));
+    os::free_memory((char*)start, bytes, page_size);
+    os::numa_make_local((char*)start, bytes, lgrp_id);
+  }
+}
+
+void PSOldGen::retire_numa_chunk(NUMAChunk* chunk) {
+  HeapWord* top = chunk->top();
+  if (top != nullptr && top < chunk->end()) {
+    size_t remaining = pointer_delta(chunk->end(), top);
+    if (object_space()->cas_deallocate(top, remaining)) {
+      // The chunk was the last allocation in the space, give it back. The
+      // freed pages no longer hold the mangle pattern.
+      if (ZapUnusedHeapArea) {
+        SpaceMangler::mangle_region(MemRegion(top, remaining));
+      }
+    } else {
+      CollectedHeap::fill_with_object(top, remaining);
+      _start_array.allocate_block(top);
+    }
+  }
+  chunk->set(nullptr, nullptr);
+}
+
+HeapWord* PSOldGen::allocate_lab(size_t word_size) {
+  NUMAChunk* chunk = _numa_chunks != nullptr ? numa_chunk_for_current_thread() : nullptr;
+  if (chunk == nullptr) {
+    return allocate(word_size);
+  }
+
+  {
+    MutexLocker ml(chunk->lock(), Mutex::_no_safepoint_check_flag);
+    HeapWord* res = chunk->allocate(word_size);
+    if (res != nullptr) {
+      _start_array.allocate_block(res);
+      return res;
+    }
+    retire_numa_chunk(chunk);
+  }
+
+  // Get a new chunk without holding the chunk lock, as expansion takes
+  // PSOldGenExpand_lock.
+  const size_t chunk_words = MAX2(NUMAPromotionChunkSize / HeapWordSize, word_size);
+  HeapWord* bottom = allocate(chunk_words);
+  if (bottom == nullptr) {
+    return allocate(word_size);
+  }
+  bias_numa_chunk(MemRegion(bottom, chunk_words), chunk->lgrp_id());
+
+  MutexLocker ml(chunk->lock(), Mutex::_no_safepoint_check_flag);
+  // Another worker of this node may have installed a chunk meanwhile.
+  retire_numa_chunk(chunk);
+  chunk->set(bottom, bottom + chunk_words);
+  HeapWord* res = chunk->allocate(word_size);
+  assert(res == bottom, "must succeed in a new chunk");
+  // allocate() already recorded the block start.
+  return res;
+}
+
+void PSOldGen::retire_numa_chunks() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  for (uint i = 0; i < _num_numa_chunks; i++) {
+    retire_numa_chunk(_numa_chunks[i]);
+  }
+}
+
 // Assume that the generation has been allocated if its
 // reserved size is not 0.
 bool  PSOldGen::is_allocated() {
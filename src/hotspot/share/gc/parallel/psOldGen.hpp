@@ -30,6 +30,7 @@
 #include "gc/parallel/psGenerationCounters.hpp"
 #include "gc/parallel/psVirtualspace.hpp"
 #include "gc/parallel/spaceCounters.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 
@@ -51,6 +52,57 @@ class PSOldGen : public CHeapObj<mtGC> {
   // Block size for parallel iteration
   static const size_t IterateBlockSize = 1024 * 1024;
 
+  // With UseNUMAPromotion, promotion LABs are carved from one chunk of old
+  // space per NUMA node. The pages of a chunk are bound to its node before
+  // first use, so objects promoted by a GC worker end up in memory local
+  // to that worker.
+  class NUMAChunk : public CHeapObj<mtGC> {
+    const int _lgrp_id;
+    Mutex     _lock;
+    HeapWord* _top;
+    HeapWord* _end;
+
+   public:
+    NUMAChunk(int lgrp_id) :
+      _lgrp_id(lgrp_id),
+      _lock(Mutex::nosafepoint, "PSOldGenNUMAChunk_lock"),
+      _top(nullptr),
+      _end(nullptr) { }
+
+    int lgrp_id() const      { return _lgrp_id; }
+    Mutex* lock()            { return &_lock; }
+    HeapWord* top() const    { return _top; }
+    HeapWord* end() const    { return _end; }
+
+    void set(HeapWord* bottom, HeapWord* end) {
+      _top = bottom;
+      _end = end;
+    }
+
+    // Bump allocate word_size words, unless that would leave a tail too
+    // small to be filled.
+    HeapWord* allocate(size_t word_size) {
+      size_t remaining = pointer_delta(_end, _top);
+      if (word_size > remaining ||
+          (word_size < remaining && remaining - word_size < CollectedHeap::min_fill_size())) {
+        return nullptr;
+      }
+      HeapWord* res = _top;
+      _top += word_size;
+      return res;
+    }
+  };
+
+  NUMAChunk** _numa_chunks;
+  uint        _num_numa_chunks;
+
+  void initialize_numa_chunks();
+  NUMAChunk* numa_chunk_for_current_thread();
+  void bias_numa_chunk(MemRegion mr, int lgrp_id);
+  // Hand back or fill the unused part of the chunk. The chunk lock must be held
+  // or the caller must be the only one using chunks.
+  void retire_numa_chunk(NUMAChunk* chunk);
+
 #ifdef ASSERT
   void assert_block_in_covered_region(MemRegion new_memregion) {
     // Explicitly capture current covered_region in a local
@@ -153,6 +205,15 @@ class PSOldGen : public CHeapObj<mtGC> {
     return res;
   }
 
+  // Allocate word_size words for a promotion LAB. With UseNUMAPromotion
+  // the memory preferably comes from the chunk of the calling thread's
+  // NUMA node.
+  HeapWord* allocate_lab(size_t word_size);
+
+  // Make the unused parts of the per-node chunks parsable again. Called
+  // at the end of a young collection after all promotion LABs are flushed.
+  void retire_numa_chunks();
+
   // Iteration.
   void oop_iterate(OopIterateClosure* cl) { object_space()->oop_iterate(cl); }
   void object_iterate(ObjectClosure* cl) { object_space()->object_iterate(cl); }
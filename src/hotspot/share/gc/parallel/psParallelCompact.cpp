@@ -53,6 +53,7 @@
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.inline.hpp"
 #include "gc/shared/oopStorageSetParState.inline.hpp"
+#include "gc/shared/parallelCleaning.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
@@ -719,59 +720,219 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
+      dest_addr = summarize_region(cur_region, split_info, dest_addr);
+    }
+
+    ++cur_region;
+  }
+
+  *target_next = dest_addr;
+  return true;
+}
+
+HeapWord* ParallelCompactData::summarize_region(size_t cur_region,
+                                                SplitInfo& split_info,
+                                                HeapWord* dest_addr)
+{
+  const size_t words = _region_data[cur_region].data_size();
+  assert(words > 0, "only regions with data need a summary");
+
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+  return dest_addr + words;
+}
+
+// The parallel summary routines divide the regions into chunks of this many
+// regions, and only run in parallel if there are at least two chunks.
+static const size_t SummaryChunkRegions = 1024;
+
+class PSSummarizeTask : public WorkerTask {
+public:
+  enum Kind {
+    DensePrefix,    // Summarize the chunks as dense prefix.
+    ChunkLive,      // Record the amount of live data of each chunk.
+    Summarize       // Summarize the chunks given the live data to their left.
+  };
+
+private:
+  ParallelCompactData& _sd;
+  const Kind           _kind;
+  SplitInfo*           _split_info;
+  const size_t         _beg_region;
+  const size_t         _end_region;
+  const size_t         _num_chunks;
+  HeapWord* const      _target_beg;
+  size_t* const        _chunk_live;
+  volatile size_t      _next_chunk;
+
+  void work_chunk(size_t chunk) {
+    const size_t beg = _beg_region + chunk * SummaryChunkRegions;
+    const size_t end = MIN2(beg + SummaryChunkRegions, _end_region);
+    switch (_kind) {
+      case DensePrefix:
+        _sd.summarize_dense_prefix(_sd.region_to_addr(beg), _sd.region_to_addr(end));
+        break;
+      case ChunkLive: {
+        size_t live = 0;
+        for (size_t cur = beg; cur < end; ++cur) {
+          live += _sd.region(cur)->data_size();
         }
+        _chunk_live[chunk] = live;
+        break;
       }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
+      case Summarize: {
+        HeapWord* dest_addr = _target_beg + _chunk_live[chunk];
+        for (size_t cur = beg; cur < end; ++cur) {
+          // The destination must be set even if the region has no data.
+          _sd.region(cur)->set_destination(dest_addr);
+          if (_sd.region(cur)->data_size() > 0) {
+            dest_addr = _sd.summarize_region(cur, *_split_info, dest_addr);
+          }
+        }
+        break;
       }
+    }
+  }
 
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
-      dest_addr += words;
+public:
+  PSSummarizeTask(ParallelCompactData& sd, Kind kind, SplitInfo* split_info,
+                  size_t beg_region, size_t end_region,
+                  HeapWord* target_beg, size_t* chunk_live) :
+    WorkerTask("PSSummarizeTask"),
+    _sd(sd),
+    _kind(kind),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _num_chunks(num_chunks(beg_region, end_region)),
+    _target_beg(target_beg),
+    _chunk_live(chunk_live),
+    _next_chunk(0) { }
+
+  static size_t num_chunks(size_t beg_region, size_t end_region) {
+    return (end_region - beg_region + SummaryChunkRegions - 1) / SummaryChunkRegions;
+  }
+
+  // Workers to use for a range of num_chunks chunks, or 1 if the range is
+  // better summarized serially.
+  static uint num_workers(size_t num_chunks, WorkerThreads* workers) {
+    return (uint)MIN2((size_t)workers->active_workers(), num_chunks);
+  }
+
+  void work(uint worker_id) override {
+    for (size_t chunk = Atomic::fetch_then_add(&_next_chunk, (size_t)1);
+         chunk < _num_chunks;
+         chunk = Atomic::fetch_then_add(&_next_chunk, (size_t)1)) {
+      work_chunk(chunk);
     }
+  }
+};
 
-    ++cur_region;
+void ParallelCompactData::par_summarize_dense_prefix(HeapWord* beg, HeapWord* end,
+                                                     WorkerThreads* workers)
+{
+  assert(is_region_aligned(beg), "not RegionSize aligned");
+  assert(is_region_aligned(end), "not RegionSize aligned");
+
+  const size_t beg_region = addr_to_region_idx(beg);
+  const size_t end_region = addr_to_region_idx(end);
+  const size_t num_chunks = PSSummarizeTask::num_chunks(beg_region, end_region);
+  const uint num_workers = PSSummarizeTask::num_workers(num_chunks, workers);
+  if (num_workers <= 1) {
+    summarize_dense_prefix(beg, end);
+    return;
   }
 
-  *target_next = dest_addr;
-  return true;
+  PSSummarizeTask task(*this, PSSummarizeTask::DensePrefix, nullptr,
+                       beg_region, end_region, nullptr, nullptr);
+  workers->run_task(&task, num_workers);
+}
+
+void ParallelCompactData::par_summarize(SplitInfo& split_info,
+                                        HeapWord* source_beg, HeapWord* source_end,
+                                        HeapWord* target_beg, HeapWord* target_end,
+                                        HeapWord** target_next, WorkerThreads* workers)
+{
+  assert(!split_info.is_valid(), "split regions must be summarized serially");
+
+  const size_t beg_region = addr_to_region_idx(source_beg);
+  const size_t end_region = addr_to_region_idx(region_align_up(source_end));
+  const size_t num_chunks = PSSummarizeTask::num_chunks(beg_region, end_region);
+  const uint num_workers = PSSummarizeTask::num_workers(num_chunks, workers);
+  if (num_workers <= 1) {
+    bool result = summarize(split_info, source_beg, source_end, nullptr,
+                            target_beg, target_end, target_next);
+    assert(result, "source must fit into target");
+    return;
+  }
+
+  size_t* chunk_live = NEW_C_HEAP_ARRAY(size_t, num_chunks, mtGC);
+  {
+    PSSummarizeTask task(*this, PSSummarizeTask::ChunkLive, &split_info,
+                         beg_region, end_region, target_beg, chunk_live);
+    workers->run_task(&task, num_workers);
+  }
+
+  // Turn the live data per chunk into the live data to the left of each chunk.
+  size_t total_live = 0;
+  for (size_t i = 0; i < num_chunks; ++i) {
+    const size_t live = chunk_live[i];
+    chunk_live[i] = total_live;
+    total_live += live;
+  }
+  assert(total_live <= pointer_delta(target_end, target_beg), "source must fit into target");
+
+  {
+    PSSummarizeTask task(*this, PSSummarizeTask::Summarize, &split_info,
+                         beg_region, end_region, target_beg, chunk_live);
+    workers->run_task(&task, num_workers);
+  }
+  FREE_C_HEAP_ARRAY(size_t, chunk_live);
+
+  *target_next = target_beg + total_live;
 }
 
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) const {
@@ -1418,13 +1579,14 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
 
 void PSParallelCompact::summarize_spaces_quick()
 {
+  GCTraceTime(Debug, gc, phases) tm("Summarize Spaces", &_gc_timer);
+  WorkerThreads* workers = &ParallelScavengeHeap::heap()->workers();
   for (unsigned int i = 0; i < last_space_id; ++i) {
     const MutableSpace* space = _space_info[i].space();
     HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), nullptr,
-                                          space->bottom(), space->end(), nta);
-    assert(result, "space must fit into itself");
+    _summary_data.par_summarize(_space_info[i].split_info(),
+                                space->bottom(), space->top(),
+                                space->bottom(), space->end(), nta, workers);
     _space_info[i].set_dense_prefix(space->bottom());
   }
 }
@@ -1505,7 +1667,11 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
 
   const MutableSpace* space = _space_info[id].space();
   if (_space_info[id].new_top() != space->bottom()) {
-    HeapWord* dense_prefix_end = compute_dense_prefix(id, maximum_compaction);
+    HeapWord* dense_prefix_end;
+    {
+      GCTraceTime(Debug, gc, phases) tm("Compute Dense Prefix", &_gc_timer);
+      dense_prefix_end = compute_dense_prefix(id, maximum_compaction);
+    }
     _space_info[id].set_dense_prefix(dense_prefix_end);
 
 #ifndef PRODUCT
@@ -1521,6 +1687,9 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
     // every last byte will be reclaimed, then the existing summary data which
     // compacts everything can be left in place.
     if (!maximum_compaction && dense_prefix_end != space->bottom()) {
+      GCTraceTime(Debug, gc, phases) tm("Summarize Dense Prefix", &_gc_timer);
+      WorkerThreads* workers = &ParallelScavengeHeap::heap()->workers();
+
       // If dead space crosses the dense prefix boundary, it is (at least
       // partially) filled with a dummy object, marked live and added to the
       // summary data.  This simplifies the copy/update phase and must be done
@@ -1529,11 +1698,12 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
       fill_dense_prefix_end(id);
 
       // Compute the destination of each Region, and thus each object.
-      _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
-      _summary_data.summarize(_space_info[id].split_info(),
-                              dense_prefix_end, space->top(), nullptr,
-                              dense_prefix_end, space->end(),
-                              _space_info[id].new_top_addr());
+      _summary_data.par_summarize_dense_prefix(space->bottom(), dense_prefix_end,
+                                               workers);
+      _summary_data.par_summarize(_space_info[id].split_info(),
+                                  dense_prefix_end, space->top(),
+                                  dense_prefix_end, space->end(),
+                                  _space_info[id].new_top_addr(), workers);
     }
   }
 
@@ -1610,6 +1780,7 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
   // is the old gen.  If a space does not fit entirely into the target, then the
   // remainder is compacted into the space itself and that space becomes the new
   // target.
+  GCTraceTime(Debug, gc, phases) tm_young("Summarize Young Gen", &_gc_timer);
   SpaceId dst_space_id = old_space_id;
   HeapWord* dst_space_end = old_space->end();
   HeapWord** new_top_addr = _space_info[dst_space_id].new_top_addr();
@@ -2010,6 +2181,19 @@ public:
   }
 };
 
+class PSCodeCacheUnloadingTask : public WorkerTask {
+  CodeCacheUnloadingTask _code_cache_task;
+
+public:
+  PSCodeCacheUnloadingTask(uint num_workers, bool unloading_occurred) :
+      WorkerTask("PSCodeCacheUnloadingTask"),
+      _code_cache_task(num_workers, unloading_occurred) {}
+
+  virtual void work(uint worker_id) {
+    _code_cache_task.work(worker_id);
+  }
+};
+
 void PSParallelCompact::marking_phase(ParallelOldTracer *gc_tracer) {
   // Recursively traverse all live objects and mark them
   GCTraceTime(Info, gc, phases) tm("Marking Phase", &_gc_timer);
@@ -2058,7 +2242,11 @@ void PSParallelCompact::marking_phase(ParallelOldTracer *gc_tracer) {
     bool purged_class = SystemDictionary::do_unloading(&_gc_timer);
 
     // Unload nmethods.
-    CodeCache::do_unloading(purged_class);
+    {
+      WorkerThreads* workers = &ParallelScavengeHeap::heap()->workers();
+      PSCodeCacheUnloadingTask task(workers->active_workers(), purged_class);
+      workers->run_task(&task);
+    }
 
     // Prune dead klasses from subklass/sibling/implementor lists.
     Klass::clean_weak_klass_links(purged_class);
@@ -434,6 +434,24 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Parallel variants of summarize_dense_prefix() and summarize() for large
+  // ranges.  The regions are divided into chunks; the destination of each
+  // chunk is found from a prefix sum of the live data of the chunks to its
+  // left.  par_summarize() requires that the source fits into the target,
+  // e.g. when a space is compacted into itself, and that no region in the
+  // source has been split.
+  void par_summarize_dense_prefix(HeapWord* beg, HeapWord* end,
+                                  WorkerThreads* workers);
+  void par_summarize(SplitInfo& split_info,
+                     HeapWord* source_beg, HeapWord* source_end,
+                     HeapWord* target_beg, HeapWord* target_end,
+                     HeapWord** target_next, WorkerThreads* workers);
+
+  // Summarize a single source region whose data fits into the target
+  // starting at dest_addr.  Returns the target address following its data.
+  HeapWord* summarize_region(size_t cur_region, SplitInfo& split_info,
+                             HeapWord* dest_addr);
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -124,6 +124,8 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
     manager->flush_labs();
     manager->flush_string_dedup_requests();
   }
+  // The LABs carved from the per-node chunks are flushed, retire the chunks.
+  ParallelScavengeHeap::heap()->old_gen()->retire_numa_chunks();
   if (!promotion_failure_occurred) {
     // If there was no promotion failure, the preserved mark stacks
     // should be empty.
@@ -140,6 +140,12 @@
           "ParallelGCThreads parallel collectors will use for garbage "     \
           "collection work")                                                \
                                                                             \
+  product(bool, UseActiveProcessorsForGCWorkers, false, EXPERIMENTAL,       \
+          "With UseDynamicNumberOfGCThreads, also limit the number of "     \
+          "active GC workers to the number of processors currently "        \
+          "available to the VM, which may change at runtime, e.g. when "    \
+          "a container's CPU quota is resized")                             \
+                                                                            \
   product(bool, InjectGCWorkerCreationFailure, false, DIAGNOSTIC,           \
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
@@ -225,6 +231,10 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(bool, ParallelRefProcClaimLists, false, EXPERIMENTAL,             \
+          "Let parallel reference processing workers claim discovered "     \
+          "lists in place instead of balancing the lists beforehand")       \
+                                                                            \
   product(size_t, ReferencesPerThread, 1000, EXPERIMENTAL,                  \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -39,6 +39,7 @@
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/nonJavaThread.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -127,6 +128,10 @@ bool ReferenceProcessor::processing_is_mt() const {
   return ParallelRefProcEnabled && _num_queues > 1;
 }
 
+bool ReferenceProcessor::processing_claims_lists() const {
+  return ParallelRefProcClaimLists && processing_is_mt();
+}
+
 void ReferenceProcessor::weak_oops_do(OopClosure* f) {
   for (uint i = 0; i < _max_num_queues * number_of_subclasses_of_ref(); i++) {
     if (UseCompressedOops) {
@@ -440,6 +445,17 @@ size_t ReferenceProcessor::total_reference_count(ReferenceType type) const {
   return total_count(list);
 }
 
+bool RefProcTask::claim_list(ReferenceType ref_type, uint& index) {
+  assert(_claim_lists, "Lists are not claimed");
+  // Claim among all lists, including those beyond the active processing
+  // degree, which are otherwise moved to the active lists by balancing.
+  if (Atomic::load(&_next_list[ref_type]) >= _ref_processor.max_num_queues()) {
+    return false;
+  }
+  index = Atomic::fetch_then_add(&_next_list[ref_type], 1u);
+  return index < _ref_processor.max_num_queues();
+}
+
 void RefProcTask::process_discovered_list(uint worker_id,
                                           ReferenceType ref_type,
                                           BoolObjectClosure* is_alive,
@@ -473,12 +489,24 @@ void RefProcTask::process_discovered_list(uint worker_id,
 
   {
     RefProcSubPhasesWorkerTimeTracker tt(subphase, _phase_times, tracker_id(worker_id));
-    size_t const removed = _ref_processor.process_discovered_list_work(dl[worker_id],
-                                                                       is_alive,
-                                                                       keep_alive,
-                                                                       enqueue,
-                                                                       do_enqueue_and_clear);
-    _phase_times->add_ref_dropped(ref_type, removed);
+    if (_claim_lists) {
+      uint index;
+      while (claim_list(ref_type, index)) {
+        size_t const removed = _ref_processor.process_discovered_list_work(dl[index],
+                                                                           is_alive,
+                                                                           keep_alive,
+                                                                           enqueue,
+                                                                           do_enqueue_and_clear);
+        _phase_times->add_ref_dropped(ref_type, removed);
+      }
+    } else {
+      size_t const removed = _ref_processor.process_discovered_list_work(dl[worker_id],
+                                                                         is_alive,
+                                                                         keep_alive,
+                                                                         enqueue,
+                                                                         do_enqueue_and_clear);
+      _phase_times->add_ref_dropped(ref_type, removed);
+    }
   }
 }
 
@@ -521,7 +549,14 @@ public:
                EnqueueDiscoveredFieldClosure* enqueue,
                VoidClosure* complete_gc) override {
     RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::KeepAliveFinalRefsSubPhase, _phase_times, tracker_id(worker_id));
-    _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], keep_alive, enqueue);
+    if (_claim_lists) {
+      uint index;
+      while (claim_list(REF_FINAL, index)) {
+        _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[index], keep_alive, enqueue);
+      }
+    } else {
+      _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], keep_alive, enqueue);
+    }
     // Close the reachable set
     complete_gc->do_void();
   }
@@ -736,7 +771,8 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
 
   RefProcMTDegreeAdjuster a(this, SoftWeakFinalRefsPhase, num_total_refs);
 
-  if (processing_is_mt()) {
+  // Workers that claim lists process them where they were discovered.
+  if (processing_is_mt() && !processing_claims_lists()) {
     RefProcBalanceQueuesTimeTracker tt(SoftWeakFinalRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredSoftRefs);
     maybe_balance_queues(_discoveredWeakRefs);
@@ -767,7 +803,7 @@ void ReferenceProcessor::process_final_keep_alive(RefProcProxyTask& proxy_task,
 
   RefProcMTDegreeAdjuster a(this, KeepAliveFinalRefsPhase, num_final_refs);
 
-  if (processing_is_mt()) {
+  if (processing_is_mt() && !processing_claims_lists()) {
     RefProcBalanceQueuesTimeTracker tt(KeepAliveFinalRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredFinalRefs);
   }
@@ -791,7 +827,7 @@ void ReferenceProcessor::process_phantom_refs(RefProcProxyTask& proxy_task,
 
   RefProcMTDegreeAdjuster a(this, PhantomRefsPhase, num_phantom_refs);
 
-  if (processing_is_mt()) {
+  if (processing_is_mt() && !processing_claims_lists()) {
     RefProcBalanceQueuesTimeTracker tt(PhantomRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredPhantomRefs);
   }
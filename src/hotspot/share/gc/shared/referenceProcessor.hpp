@@ -407,6 +407,10 @@ public:
   // Whether we are in a phase when _processing_ is MT.
   bool processing_is_mt() const;
 
+  // Whether MT processing workers claim discovered lists in place, in
+  // which case the lists are not balanced before processing.
+  bool processing_claims_lists() const;
+
   // iterate over oops
   void weak_oops_do(OopClosure* f);       // weak roots
 
@@ -520,11 +524,20 @@ protected:
   ReferenceProcessor& _ref_processor;
   ReferenceProcessorPhaseTimes* _phase_times;
 
+  // If set, workers claim discovered lists of each reference type through
+  // _next_list instead of processing the list matching their worker id.
+  const bool _claim_lists;
+  volatile uint _next_list[REF_PHANTOM + 1];
+
   // Used for tracking how much time a worker spends in a (sub)phase.
   uint tracker_id(uint worker_id) const {
     return _ref_processor.processing_is_mt() ? worker_id : 0;
   }
 
+  // Claim the index of the next discovered list of the given type to
+  // process. Returns false when all lists have been claimed.
+  bool claim_list(ReferenceType ref_type, uint& index);
+
   void process_discovered_list(uint worker_id,
                                ReferenceType ref_type,
                                BoolObjectClosure* is_alive,
@@ -534,7 +547,9 @@ public:
   RefProcTask(ReferenceProcessor& ref_processor,
               ReferenceProcessorPhaseTimes* phase_times)
     : _ref_processor(ref_processor),
-      _phase_times(phase_times) {}
+      _phase_times(phase_times),
+      _claim_lists(ref_processor.processing_claims_lists()),
+      _next_list() {}
 
   virtual void rp_work(uint worker_id,
                        BoolObjectClosure* is_alive,
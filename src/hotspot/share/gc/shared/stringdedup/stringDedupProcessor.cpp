@@ -60,7 +60,13 @@ void StringDedup::Processor::initialize_storage() {
   _storage_for_processing = new StorageUse(_storages[1]);
 }
 
-StringDedup::Processor::Processor() : _thread(nullptr) {}
+StringDedup::Processor::Processor() :
+  _thread(nullptr),
+  _par_state(nullptr),
+  _helpers_epoch(0),
+  _active_helpers(0),
+  _helpers_stat(new Stat())
+{}
 
 void StringDedup::Processor::initialize() {
   _processor = new Processor();
@@ -117,6 +123,8 @@ void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
 
 class StringDedup::Processor::ProcessRequest final : public OopClosure {
   OopStorage* _storage;
+  JavaThread* _thread;
+  Stat* _stat;
   size_t _release_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
 
@@ -131,8 +139,10 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   }
 
 public:
-  ProcessRequest(OopStorage* storage) :
+  ProcessRequest(OopStorage* storage, JavaThread* thread, Stat* stat) :
     _storage(storage),
+    _thread(thread),
+    _stat(stat),
     _release_index(0),
     _bulk_release()
   {}
@@ -144,33 +154,77 @@ public:
   virtual void do_oop(narrowOop*) { ShouldNotReachHere(); }
 
   virtual void do_oop(oop* ref) {
-    _processor->yield();
+    {
+      // Yield if requested.
+      ThreadBlockInVM tbivm(_thread);
+    }
     oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
     release_ref(ref);
     // Dedup java_string, after checking for various reasons to skip it.
     if (java_string == nullptr) {
       // String became unreachable before we got a chance to process it.
-      _cur_stat.inc_skipped_dead();
+      _stat->inc_skipped_dead();
     } else if (java_lang_String::value(java_string) == nullptr) {
       // Request during String construction, before its value array has
       // been initialized.
-      _cur_stat.inc_skipped_incomplete();
+      _stat->inc_skipped_incomplete();
     } else {
-      Table::deduplicate(java_string);
-      if (Table::is_grow_needed()) {
-        _cur_stat.report_process_pause();
+      Table::deduplicate(java_string, _stat);
+      // Growing while helper threads use the table is not supported, so
+      // with helpers that waits until the end of the batch.
+      if ((StringDeduplicationThreads == 1) && Table::is_grow_needed()) {
+        _stat->report_process_pause();
         _processor->cleanup_table(true /* grow_only */, false /* force */);
-        _cur_stat.report_process_resume();
+        _stat->report_process_resume();
       }
     }
   }
 };
 
-void StringDedup::Processor::process_requests() const {
+void StringDedup::Processor::start_helpers(ParState* par_state) {
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  assert(_active_helpers == 0, "helpers still running");
+  _par_state = par_state;
+  _active_helpers = StringDeduplicationThreads - 1;
+  ++_helpers_epoch;
+  ml.notify_all();
+}
+
+void StringDedup::Processor::wait_for_helpers() {
+  {
+    ThreadBlockInVM tbivm(_thread);
+    MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+    while (_active_helpers > 0) {
+      ml.wait();
+    }
+    _par_state = nullptr;
+  }
+  _cur_stat.add_counters(_helpers_stat);
+  *_helpers_stat = Stat{};
+}
+
+void StringDedup::Processor::process_requests() {
   _cur_stat.report_process_start();
-  OopStorage::ParState<true, false> par_state{_storage_for_processing->storage(), 1};
-  ProcessRequest processor{_storage_for_processing->storage()};
-  par_state.oops_do(&processor);
+  OopStorage* storage = _storage_for_processing->storage();
+  ParState par_state{storage, StringDeduplicationThreads};
+  if (StringDeduplicationThreads == 1) {
+    ProcessRequest processor{storage, _thread, &_cur_stat};
+    par_state.oops_do(&processor);
+  } else {
+    start_helpers(&par_state);
+    Stat stat{};
+    stat.report_process_start();
+    {
+      ProcessRequest processor{storage, _thread, &stat};
+      par_state.oops_do(&processor);
+    }
+    stat.report_process_end();
+    if (log_is_enabled(Debug, stringdedup)) {
+      stat.log_thread_throughput(0);
+    }
+    _cur_stat.add_counters(&stat);
+    wait_for_helpers();
+  }
   _cur_stat.report_process_end();
 }
 
@@ -190,6 +244,39 @@ void StringDedup::Processor::run(JavaThread* thread) {
   }
 }
 
+void StringDedup::Processor::run_helper(JavaThread* thread, uint thread_id) {
+  assert(thread == Thread::current(), "precondition");
+  log_debug(stringdedup)("Starting string deduplication helper thread %u", thread_id);
+  uint seen_epoch = 0;
+  while (true) {
+    ParState* par_state;
+    {
+      ThreadBlockInVM tbivm(thread);
+      MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+      while (_helpers_epoch == seen_epoch) {
+        ml.wait();
+      }
+      seen_epoch = _helpers_epoch;
+      par_state = _par_state;
+    }
+    Stat stat{};
+    stat.report_process_start();
+    {
+      ProcessRequest processor{_storage_for_processing->storage(), thread, &stat};
+      par_state->oops_do(&processor);
+    }
+    stat.report_process_end();
+    if (log_is_enabled(Debug, stringdedup)) {
+      stat.log_thread_throughput(thread_id);
+    }
+    MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+    _helpers_stat->add_counters(&stat);
+    if (--_active_helpers == 0) {
+      ml.notify_all();
+    }
+  }
+}
+
 void StringDedup::Processor::log_statistics() {
   _total_stat.add(&_cur_stat);
   Stat::log_summary(&_cur_stat, &_total_stat);
@@ -25,18 +25,23 @@
 #ifndef SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
 #define SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
 
+#include "gc/shared/oopStorage.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/macros.hpp"
 
 class JavaThread;
-class OopStorage;
 
 // This class performs string deduplication.  There is only one instance of
 // this class.  It processes deduplication requests.  It also manages the
 // deduplication table, performing resize and cleanup operations as needed.
 // This includes managing the OopStorage objects used to hold requests.
 //
+// With StringDeduplicationThreads > 1, the additional threads help with
+// processing the requests.  They are started by the main thread for each
+// batch of requests, and the main thread waits for them to finish before
+// performing any table resize or cleanup.
+//
 // Processing periodically checks for and yields at safepoints.  Processing of
 // requests is performed in incremental chunks.  The Table provides
 // incremental operations for resizing and for removing dead entries, so
@@ -53,6 +58,13 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
 
   JavaThread* _thread;
 
+  // Helper thread coordination, protected by StringDedup_lock.
+  using ParState = OopStorage::ParState<true, false>;
+  ParState* _par_state;
+  uint _helpers_epoch;
+  uint _active_helpers;
+  Stat* _helpers_stat;
+
   // Wait until there are requests to be processed.  The storage for requests
   // and storage for processing are swapped; the former requests storage
   // becomes the current processing storage, and vice versa.
@@ -63,7 +75,9 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   void yield() const;
 
   class ProcessRequest;
-  void process_requests() const;
+  void process_requests();
+  void start_helpers(ParState* par_state);
+  void wait_for_helpers();
   void cleanup_table(bool grow_only, bool force) const;
 
   void log_statistics();
@@ -77,6 +91,10 @@ public:
   // Use thread as the deduplication thread.
   // precondition: thread == Thread::current()
   void run(JavaThread* thread);
+
+  // Use thread as an additional thread processing requests.
+  // precondition: thread == Thread::current()
+  void run_helper(JavaThread* thread, uint thread_id);
 };
 
 #endif // SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
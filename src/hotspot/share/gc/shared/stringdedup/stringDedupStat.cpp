@@ -54,7 +54,7 @@ StringDedup::Stat::Stat() :
   _cleanup_table_elapsed()
 {}
 
-void StringDedup::Stat::add(const Stat* const stat) {
+void StringDedup::Stat::add_counters(const Stat* const stat) {
   _inspected           += stat->_inspected;
   _known               += stat->_known;
   _known_shared        += stat->_known_shared;
@@ -67,6 +67,10 @@ void StringDedup::Stat::add(const Stat* const stat) {
   _skipped_dead        += stat->_skipped_dead;
   _skipped_incomplete  += stat->_skipped_incomplete;
   _skipped_shared      += stat->_skipped_shared;
+}
+
+void StringDedup::Stat::add(const Stat* const stat) {
+  add_counters(stat);
   _active              += stat->_active;
   _idle                += stat->_idle;
   _process             += stat->_process;
@@ -230,3 +234,10 @@ void StringDedup::Stat::log_statistics(bool total) const {
   log_debug(stringdedup)("    Skipped: %zu (dead), %zu (incomplete), %zu (shared)",
                          _skipped_dead, _skipped_incomplete, _skipped_shared);
 }
+
+void StringDedup::Stat::log_thread_throughput(uint thread_id) const {
+  double elapsed_ms = strdedup_elapsed_param_ms(_process_elapsed);
+  double rate = (elapsed_ms > 0.0) ? (_inspected / elapsed_ms) : 0.0;
+  log_debug(stringdedup)("  Thread %u Process: %zu inspected in " STRDEDUP_ELAPSED_FORMAT_MS
+                         ", %.1f/ms", thread_id, _inspected, elapsed_ms, rate);
+}
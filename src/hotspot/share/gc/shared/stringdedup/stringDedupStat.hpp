@@ -32,7 +32,9 @@
 // Deduplication statistics.
 //
 // Operation counters are updated when deduplicating a string.
-// Phase timing information is collected by the processing thread.
+// Phase timing information is collected by the processing thread.  Each
+// additional processing thread has its own Stat, which is summed up into
+// the main thread's after processing.
 class StringDedup::Stat {
 private:
   // Counters
@@ -147,8 +149,12 @@ public:
   void report_active_start();
   void report_active_end();
 
+  // Add the operation counters of stat, but not its phase information.
+  void add_counters(const Stat* const stat);
   void add(const Stat* const stat);
   void log_statistics(bool total) const;
+  // Log the requests processed by a deduplication thread and its rate.
+  void log_thread_throughput(uint thread_id) const;
 
   static void log_summary(const Stat* last_stat, const Stat* total_stat);
 };
@@ -501,9 +501,9 @@ StringDedup::Table::find(typeArrayOop obj, uint hash_code) {
   return _buckets[hash_to_index(hash_code)].find(obj, hash_code);
 }
 
-void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
+void StringDedup::Table::install(typeArrayOop obj, uint hash_code, Stat* stat) {
   add(TableValue(_table_storage, obj), hash_code);
-  _cur_stat.inc_new(obj->size() * HeapWordSize);
+  stat->inc_new(obj->size() * HeapWordSize);
 }
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -514,7 +514,7 @@ void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
 // of the string we're deduplicating.  GC requests can provide us with
 // access to a String that is incompletely constructed; the value could be
 // set before the coder.
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   typeArrayOop value = java_lang_String::value(java_string);
   assert(value != nullptr, "precondition");
   assert(TypeArrayKlass::cast(value->klass())->element_type() == T_BYTE, "precondition");
@@ -534,7 +534,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
     // table key, so not actually a match to value.
     if ((found != nullptr) &&
         !java_lang_String::is_latin1(found) &&
-        try_deduplicate_found_shared(java_string, found)) {
+        try_deduplicate_found_shared(java_string, found, stat)) {
       return true;
     }
     // That didn't work.  Try as compact latin1.
@@ -547,7 +547,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   ResourceMark rm(Thread::current());
   jchar* chars = NEW_RESOURCE_ARRAY_RETURN_NULL(jchar, length);
   if (chars == nullptr) {
-    _cur_stat.inc_skipped_shared();
+    stat->inc_skipped_shared();
     return true;
   }
   for (int i = 0; i < length; ++i) {
@@ -556,11 +556,11 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   oop found = StringTable::lookup_shared(chars, length);
   if (found == nullptr) return false;
   assert(java_lang_String::is_latin1(found), "invariant");
-  return try_deduplicate_found_shared(java_string, found);
+  return try_deduplicate_found_shared(java_string, found, stat);
 }
 
-bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found) {
-  _cur_stat.inc_known_shared();
+bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat) {
+  stat->inc_known_shared();
   typeArrayOop found_value = java_lang_String::value(found);
   if (found_value == java_lang_String::value(java_string)) {
     // String's value already matches what's in the table.
@@ -571,7 +571,7 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
     // shared string.  But if they have different coders but happen to have
     // the same sequence of bytes in their value arrays, then java_string
     // could have been interned and marked deduplication-forbidden.
-    _cur_stat.inc_deduped(found_value->size() * HeapWordSize);
+    stat->inc_deduped(found_value->size() * HeapWordSize);
     return true;
   } else {
     // Must be a mismatch between java_string and found string encodings,
@@ -585,13 +585,13 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
 
 #else // if !INCLUDE_CDS_JAVA_HEAP
 
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   ShouldNotReachHere();         // Call is guarded.
   return false;
 }
 
 // Undefined because unreferenced.
-// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found);
+// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
 
 #endif // INCLUDE_CDS_JAVA_HEAP
 
@@ -607,36 +607,49 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
   }
 }
 
-void StringDedup::Table::deduplicate(oop java_string) {
+// Only the lookup and update of the table need the lock when there are
+// several processing threads.  Hashing, the shared StringTable lookup and
+// the deduplication itself are done in parallel.
+static Mutex* table_lock() {
+  return (StringDeduplicationThreads > 1) ? StringDedupTable_lock : nullptr;
+}
+
+void StringDedup::Table::deduplicate(oop java_string, Stat* stat) {
   assert(java_lang_String::is_instance(java_string), "precondition");
-  _cur_stat.inc_inspected();
+  stat->inc_inspected();
   if ((StringTable::shared_entry_count() > 0) &&
-      try_deduplicate_shared(java_string)) {
+      try_deduplicate_shared(java_string, stat)) {
     return;                     // Done if deduplicated against shared StringTable.
   }
   typeArrayOop value = java_lang_String::value(java_string);
   uint hash_code = compute_hash(value);
-  TableValue tv = find(value, hash_code);
-  if (tv.is_empty()) {
-    // Not in table.  Create a new table entry.
-    install(value, hash_code);
-  } else {
-    _cur_stat.inc_known();
-    typeArrayOop found = cast_from_oop<typeArrayOop>(tv.resolve());
-    assert(found != nullptr, "invariant");
-    // Deduplicate if value array differs from what's in the table.
-    if (found != value) {
-      if (deduplicate_if_permitted(java_string, found)) {
-        _cur_stat.inc_deduped(found->size() * HeapWordSize);
-      } else {
-        // If string marked deduplication_forbidden then we can't update its
-        // value.  Instead, replace the array in the table with the new one,
-        // as java_string is probably in the StringTable.  That makes it a
-        // good target for future deduplications as it is probably intended
-        // to live for some time.
-        tv.replace(value);
-        _cur_stat.inc_replaced();
-      }
+  TableValue tv;
+  typeArrayOop found;
+  {
+    MutexLocker ml(table_lock(), Mutex::_no_safepoint_check_flag);
+    tv = find(value, hash_code);
+    if (tv.is_empty()) {
+      // Not in table.  Create a new table entry.
+      install(value, hash_code, stat);
+      return;
+    }
+    found = cast_from_oop<typeArrayOop>(tv.resolve());
+  }
+  stat->inc_known();
+  assert(found != nullptr, "invariant");
+  // Deduplicate if value array differs from what's in the table.
+  if (found != value) {
+    if (deduplicate_if_permitted(java_string, found)) {
+      stat->inc_deduped(found->size() * HeapWordSize);
+    } else {
+      // If string marked deduplication_forbidden then we can't update its
+      // value.  Instead, replace the array in the table with the new one,
+      // as java_string is probably in the StringTable.  That makes it a
+      // good target for future deduplications as it is probably intended
+      // to live for some time.
+      MutexLocker ml(table_lock(), Mutex::_no_safepoint_check_flag);
+      tv.replace(value);
+      stat->inc_replaced();
     }
   }
 }
@@ -46,8 +46,10 @@ class OopStorage;
 // controlling the growth or shrinkage of the hashtable.
 //
 // Operations on the table are not thread-safe.  Only the deduplication
-// thread calls most of the operations on the table.  The only exception is
-// the GC dead object count notification and the management of its state.
+// thread calls most of the operations on the table.  The exceptions are
+// deduplicate, which is called by all processing threads and serializes the
+// table accesses when there are several, and the GC dead object count
+// notification and the management of its state.
 //
 // The table supports resizing and removal of entries for byte arrays that
 // have become unreferenced.  These operations are performed by the
@@ -94,10 +96,10 @@ private:
   static size_t hash_to_index(uint hash_code);
   static void add(TableValue tv, uint hash_code);
   static TableValue find(typeArrayOop obj, uint hash_code);
-  static void install(typeArrayOop obj, uint hash_code);
+  static void install(typeArrayOop obj, uint hash_code, Stat* stat);
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
-  static bool try_deduplicate_shared(oop java_string);
-  static bool try_deduplicate_found_shared(oop java_string, oop found);
+  static bool try_deduplicate_shared(oop java_string, Stat* stat);
+  static bool try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
   static Bucket* make_buckets(size_t number_of_buckets, size_t reserve = 0);
   static void free_buckets(Bucket* buckets, size_t number_of_buckets);
 
@@ -114,8 +116,10 @@ public:
 
   // Deduplicate java_string.  If the table already contains the string's
   // data array, replace the string's data array with the one in the table.
-  // Otherwise, add the string's data array to the table.
-  static void deduplicate(oop java_string);
+  // Otherwise, add the string's data array to the table.  The outcome is
+  // recorded in stat.
+  // precondition: no cleanup is in progress if StringDeduplicationThreads > 1.
+  static void deduplicate(oop java_string, Stat* stat);
 
   // Returns true if table needs to grow.
   static bool is_grow_needed();
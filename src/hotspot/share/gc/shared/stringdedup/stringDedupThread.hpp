@@ -30,9 +30,10 @@
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
 
-// Thread class for string deduplication.  There is only one instance of this
-// class.  This class provides thread management.  It uses the Processor
-// to perform most of the work.
+// Thread class for string deduplication.  There is one instance of this
+// class per StringDeduplicationThreads, the first being the main
+// deduplication thread.  This class provides thread management.  It uses
+// the Processor to perform most of the work.
 //
 // Unlike most of the classes in the stringdedup implementation, this class is
 // not an inner class of StringDedup.  This is because we need a simple public
@@ -40,7 +41,9 @@
 class StringDedupThread : public JavaThread {
   friend class VMStructs;
 
-  StringDedupThread();
+  const uint _thread_id;
+
+  explicit StringDedupThread(uint thread_id);
   ~StringDedupThread() = default;
 
   NONCOPYABLE(StringDedupThread);
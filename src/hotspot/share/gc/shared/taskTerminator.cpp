@@ -111,6 +111,14 @@ size_t TaskTerminator::tasks_in_queue_set() const {
   return _queue_set->tasks();
 }
 
+size_t TaskTerminator::tasks_to_wake_up_for(size_t tasks) const {
+  if (tasks == 0) {
+    return 0;
+  }
+
+  return MIN2(tasks, (size_t)MAX2(_queue_set->non_empty_queues(), 1u));
+}
+
 void TaskTerminator::prepare_for_return(Thread* this_thread, size_t tasks) {
   assert(_blocker.is_locked(), "must be");
   assert(_blocker.owned_by_self(), "must be");
@@ -166,6 +174,9 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
           // is potentially a long operation making the locked section long.
           tasks = tasks_in_queue_set();
           should_exit_termination = exit_termination(tasks, terminator);
+          if (should_exit_termination) {
+            tasks = tasks_to_wake_up_for(tasks);
+          }
         }
         // Immediately check exit conditions after re-acquiring the lock.
         if (_offered_termination == _n_threads) {
@@ -193,10 +204,18 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
       prepare_for_return(the_thread, 0);
       _offered_termination--;
       return false;
+    } else if (_spin_master != nullptr) {
+      // The spin master polls the queue set on behalf of all waiting
+      // threads, avoid scanning the queues again while holding the lock.
+      if (exit_termination(0, terminator)) {
+        prepare_for_return(the_thread, 0);
+        _offered_termination--;
+        return false;
+      }
     } else {
       size_t tasks = tasks_in_queue_set();
       if (exit_termination(tasks, terminator)) {
-        prepare_for_return(the_thread, tasks);
+        prepare_for_return(the_thread, tasks_to_wake_up_for(tasks));
         _offered_termination--;
         return false;
       }
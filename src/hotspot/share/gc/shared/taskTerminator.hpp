@@ -91,6 +91,14 @@ class TaskTerminator : public CHeapObj<mtGC> {
 
   size_t tasks_in_queue_set() const;
 
+  // Number of waiting threads worth waking up when tasks have been
+  // observed. Every thief can only steal from a non-empty queue, so
+  // waking more threads than there are non-empty queues mostly results
+  // in failed steal attempts and new termination offers. The threads
+  // that do find work will make their own queues non-empty, which lets
+  // the next spin master wake up more threads.
+  size_t tasks_to_wake_up_for(size_t tasks) const;
+
   // Perform one iteration of spin-master work.
   void do_delay_step(DelayContext& delay_context);
 
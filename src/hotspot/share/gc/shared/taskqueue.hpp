@@ -383,6 +383,11 @@ public:
   // recently pushed).
   PopResult pop_global(E& t);
 
+  // Plain task queues have no overflow that can be stolen, see
+  // OverflowTaskQueue.
+  uint stealable_overflow_size() const { return 0; }
+  bool steal_overflow_chunk(GenericTaskQueue* thief, E& t) { return false; }
+
   // Delete any resource associated with the queue.
   ~GenericTaskQueue();
 
@@ -428,6 +433,14 @@ public:
 // Note that size() is not hidden--it returns the number of elements in the
 // TaskQueue, and does not include the size of the overflow stack.  This
 // simplifies replacement of GenericTaskQueues with OverflowTaskQueues.
+//
+// The overflow stack is private to the owner. To keep load balancing working
+// when a worker produces more tasks than fit in the TaskQueue, the owner
+// moves overflow tasks in batches into chunks on a stealable overflow list
+// once the overflow stack has grown large. Thieves that find the sampled
+// TaskQueues empty claim a whole chunk and push its tasks onto their own
+// queue. The owner reclaims its own chunks when the overflow stack runs dry,
+// so overflow_empty() is only true when both are empty.
 template<class E, MEMFLAGS F, unsigned int N = TASKQUEUE_SIZE>
 class OverflowTaskQueue: public GenericTaskQueue<E, F, N>
 {
@@ -437,6 +450,9 @@ public:
 
   TASKQUEUE_STATS_ONLY(using taskqueue_t::stats;)
 
+  OverflowTaskQueue();
+  ~OverflowTaskQueue();
+
   // Push task t onto the queue or onto the overflow stack.  Return true.
   inline bool push(E t);
   // Try to push task t onto the queue only. Returns true if successful, false otherwise.
@@ -447,14 +463,52 @@ public:
 
   inline overflow_t* overflow_stack() { return &_overflow_stack; }
 
+  // Number of tasks in chunks that can be claimed by other threads.
+  uint stealable_overflow_size() const { return Atomic::load(&_stealable_size); }
+
+  // Claim a chunk of overflow tasks on behalf of the thief queue. The tasks
+  // are pushed onto the thief, except one which is returned in t. Returns
+  // false if there was no chunk to claim.
+  bool steal_overflow_chunk(OverflowTaskQueue* thief, E& t);
+
+  // Discard all overflow tasks, including published chunks.
+  void clear_overflow();
+
   inline bool taskqueue_empty() const { return taskqueue_t::is_empty(); }
-  inline bool overflow_empty()  const { return _overflow_stack.is_empty(); }
+  inline bool overflow_empty()  const {
+    return _overflow_stack.is_empty() && stealable_overflow_size() == 0;
+  }
   inline bool is_empty()        const {
     return taskqueue_empty() && overflow_empty();
   }
 
 private:
-  overflow_t _overflow_stack;
+  class OverflowChunk : public CHeapObj<F> {
+  public:
+    // Number of tasks that fit in about a page, like a Stack segment
+    static const size_t Capacity = (4096 - 2 * sizeof(void*)) / sizeof(E);
+
+    OverflowChunk* _next;
+    size_t         _size;
+    E              _elems[Capacity];
+
+    OverflowChunk() : _next(nullptr), _size(0) {}
+  };
+
+  // Move a batch of tasks from the overflow stack into a stealable chunk.
+  void publish_overflow_chunk();
+  // Take a chunk from the stealable list, or null if there is none.
+  OverflowChunk* claim_overflow_chunk();
+  // Move the tasks of one of our own published chunks back onto the
+  // overflow stack. Returns false if there was nothing to reclaim.
+  bool reclaim_overflow_chunk();
+
+  overflow_t             _overflow_stack;
+
+  // Stealable overflow, shared with other threads.
+  OverflowChunk*         _stealable_chunks;
+  volatile uint          _stealable_size;
+  volatile int           _stealable_lock;
 };
 
 class TaskQueueSetSuper {
@@ -465,6 +519,9 @@ public:
 
   // Tasks in queue
   virtual uint tasks() const = 0;
+
+  // Number of queues with tasks that can be stolen
+  virtual uint non_empty_queues() const = 0;
 };
 
 template <MEMFLAGS F> class TaskQueueSetSuperImpl: public CHeapObj<F>, public TaskQueueSetSuper {
@@ -503,6 +560,12 @@ public:
 
   virtual uint tasks() const;
 
+  virtual uint non_empty_queues() const;
+
+  // Try to claim a chunk of stealable overflow tasks from some other queue
+  // than queue_num. Used when stealing from the TaskQueues failed.
+  bool steal_overflow(uint queue_num, E& t);
+
   uint size() const { return _n; }
 
 #if TASKQUEUE_STATS
@@ -543,7 +606,18 @@ template<class T, MEMFLAGS F>
 uint GenericTaskQueueSet<T, F>::tasks() const {
   uint n = 0;
   for (uint j = 0; j < _n; j++) {
-    n += _queues[j]->size();
+    n += _queues[j]->size() + _queues[j]->stealable_overflow_size();
+  }
+  return n;
+}
+
+template<class T, MEMFLAGS F>
+uint GenericTaskQueueSet<T, F>::non_empty_queues() const {
+  uint n = 0;
+  for (uint j = 0; j < _n; j++) {
+    if (_queues[j]->size() > 0 || _queues[j]->stealable_overflow_size() > 0) {
+      n++;
+    }
   }
   return n;
 }
@@ -34,6 +34,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -134,15 +135,108 @@ GenericTaskQueue<E, F, N>::push(E t) {
   return false;                 // Queue is full.
 }
 
+template <class E, MEMFLAGS F, unsigned int N>
+OverflowTaskQueue<E, F, N>::OverflowTaskQueue() :
+  taskqueue_t(),
+  _overflow_stack(),
+  _stealable_chunks(nullptr),
+  _stealable_size(0),
+  _stealable_lock(0) {}
+
+template <class E, MEMFLAGS F, unsigned int N>
+OverflowTaskQueue<E, F, N>::~OverflowTaskQueue() {
+  clear_overflow();
+}
+
 template <class E, MEMFLAGS F, unsigned int N>
 inline bool OverflowTaskQueue<E, F, N>::push(E t) {
   if (!taskqueue_t::push(t)) {
     overflow_stack()->push(t);
     TASKQUEUE_STATS_ONLY(stats.record_overflow(overflow_stack()->size()));
+    // Keep one chunk worth of tasks private, publish the rest
+    if (overflow_stack()->size() >= 2 * OverflowChunk::Capacity) {
+      publish_overflow_chunk();
+    }
   }
   return true;
 }
 
+template <class E, MEMFLAGS F, unsigned int N>
+void OverflowTaskQueue<E, F, N>::publish_overflow_chunk() {
+  OverflowChunk* const chunk = new OverflowChunk();
+  for (; chunk->_size < OverflowChunk::Capacity; chunk->_size++) {
+    chunk->_elems[chunk->_size] = overflow_stack()->pop();
+  }
+
+  Thread::SpinAcquire(&_stealable_lock, "OverflowTaskQueue");
+  chunk->_next = _stealable_chunks;
+  _stealable_chunks = chunk;
+  Atomic::add(&_stealable_size, (uint)chunk->_size);
+  Thread::SpinRelease(&_stealable_lock);
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+typename OverflowTaskQueue<E, F, N>::OverflowChunk* OverflowTaskQueue<E, F, N>::claim_overflow_chunk() {
+  if (stealable_overflow_size() == 0) {
+    // Avoid taking the lock if there is nothing to claim
+    return nullptr;
+  }
+
+  Thread::SpinAcquire(&_stealable_lock, "OverflowTaskQueue");
+  OverflowChunk* const chunk = _stealable_chunks;
+  if (chunk != nullptr) {
+    _stealable_chunks = chunk->_next;
+    Atomic::sub(&_stealable_size, (uint)chunk->_size);
+  }
+  Thread::SpinRelease(&_stealable_lock);
+
+  return chunk;
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+bool OverflowTaskQueue<E, F, N>::reclaim_overflow_chunk() {
+  OverflowChunk* const chunk = claim_overflow_chunk();
+  if (chunk == nullptr) {
+    return false;
+  }
+
+  for (size_t i = chunk->_size; i > 0; i--) {
+    overflow_stack()->push(chunk->_elems[i - 1]);
+  }
+  delete chunk;
+
+  return true;
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+bool OverflowTaskQueue<E, F, N>::steal_overflow_chunk(OverflowTaskQueue* thief, E& t) {
+  assert(thief != this, "Should not steal from own queue");
+
+  OverflowChunk* const chunk = claim_overflow_chunk();
+  if (chunk == nullptr) {
+    return false;
+  }
+
+  assert(chunk->_size > 0, "Published chunks are never empty");
+  t = chunk->_elems[0];
+  for (size_t i = 1; i < chunk->_size; i++) {
+    thief->push(chunk->_elems[i]);
+  }
+  delete chunk;
+
+  return true;
+}
+
+template <class E, MEMFLAGS F, unsigned int N>
+void OverflowTaskQueue<E, F, N>::clear_overflow() {
+  overflow_stack()->clear();
+
+  OverflowChunk* chunk;
+  while ((chunk = claim_overflow_chunk()) != nullptr) {
+    delete chunk;
+  }
+}
+
 template <class E, MEMFLAGS F, unsigned int N>
 inline bool OverflowTaskQueue<E, F, N>::try_push_to_taskqueue(E t) {
   return taskqueue_t::push(t);
@@ -227,7 +321,7 @@ GenericTaskQueue<E, F, N>::pop_local(E& t, uint threshold) {
 template <class E, MEMFLAGS F, unsigned int N>
 bool OverflowTaskQueue<E, F, N>::pop_overflow(E& t)
 {
-  if (overflow_empty()) return false;
+  if (overflow_stack()->is_empty() && !reclaim_overflow_chunk()) return false;
   t = overflow_stack()->pop();
   return true;
 }
@@ -391,6 +485,22 @@ bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
       TASKQUEUE_STATS_ONLY(contended_in_a_row = 0;)
     }
   }
+  return steal_overflow(queue_num, t);
+}
+
+template<class T, MEMFLAGS F>
+bool GenericTaskQueueSet<T, F>::steal_overflow(uint queue_num, E& t) {
+  T* const local_queue = queue(queue_num);
+  // Start at a random queue to spread out the thieves
+  uint const start = local_queue->next_random_queue_id() % _n;
+  for (uint i = 0; i < _n; i++) {
+    uint const k = (start + i) % _n;
+    if (k != queue_num &&
+        queue(k)->stealable_overflow_size() > 0 &&
+        queue(k)->steal_overflow_chunk(local_queue, t)) {
+      return true;
+    }
+  }
   return false;
 }
 
@@ -109,6 +109,12 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+    // A thread that did not allocate since the last GC keeps the desired
+    // size of its last active period. Decay it so that a thread that wakes
+    // up briefly does not retire a mostly empty, large TLAB as waste.
+    if (TLABShrinkIdleThreads && allocated_since_last_gc == 0 && used > 0.5 * capacity) {
+      _allocation_fraction.sample(0.0f);
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -70,6 +70,11 @@
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, TLABShrinkIdleThreads, false, EXPERIMENTAL,                 \
+          "Count GC intervals in which a thread did not allocate at all "   \
+          "as zero allocation when averaging its TLAB size, so that "       \
+          "threads which went idle get smaller TLABs")                      \
+                                                                            \
   /* Limit the lower bound of this flag to 1 as it is used  */              \
   /* in a division expression.                              */              \
   product(uintx, TLABWasteTargetPercent, 1,                                 \
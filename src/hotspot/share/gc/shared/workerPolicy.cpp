@@ -128,6 +128,13 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
       MAX2(min_workers, (prev_active_workers + new_active_workers) / 2);
   }
 
+  // Do not use more workers than there are processors available right
+  // now. os::active_processor_count() follows cgroup CPU limit changes.
+  if (UseActiveProcessorsForGCWorkers) {
+    new_active_workers = MAX2(min_workers,
+                              MIN2(new_active_workers, (uintx) os::active_processor_count()));
+  }
+
   // Check once more that the number of workers is within the limits.
   assert(min_workers <= total_workers, "Minimum workers not consistent with total workers");
   assert(new_active_workers >= min_workers, "Minimum workers not observed");
@@ -62,7 +62,7 @@ template <class E, MEMFLAGS F, unsigned int N>
 void BufferedOverflowTaskQueue<E, F, N>::clear() {
     _buf_empty = true;
     taskqueue_t::set_empty();
-    taskqueue_t::overflow_stack()->clear();
+    taskqueue_t::clear_overflow();
 }
 
 
@@ -26,8 +26,13 @@
 
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/workerPolicy.hpp"
+#include "gc/shenandoah/shenandoahFreeSet.hpp"
+#include "gc/shenandoah/shenandoahHeap.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
+#include "logging/log.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
+#include "runtime/os_perf.hpp"
 #include "runtime/threads.hpp"
 
 uint ShenandoahWorkerPolicy::_prev_par_marking     = 0;
@@ -42,6 +47,65 @@ uint ShenandoahWorkerPolicy::_prev_par_update_ref  = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_cleanup    = 0;
 uint ShenandoahWorkerPolicy::_prev_conc_reset      = 0;
 
+CPUPerformanceInterface* ShenandoahWorkerPolicy::_cpu_perf = nullptr;
+bool ShenandoahWorkerPolicy::_cpu_perf_disabled = false;
+
+uint ShenandoahWorkerPolicy::elastic_conc_workers(uint workers) {
+  if (!ShenandoahElasticConcWorkers) {
+    return workers;
+  }
+
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t min_free = heap->soft_max_capacity() / 100 * ShenandoahMinFreeThreshold;
+  size_t available = heap->free_set()->available();
+  if (available < min_free) {
+    // Application allocates faster than we collect: finish as soon as possible.
+    log_debug(gc, ergo)("Elastic workers: using %u workers, free heap " SIZE_FORMAT "%s below threshold",
+                        workers, byte_size_in_proper_unit(available), proper_unit_for_byte_size(available));
+    return workers;
+  }
+
+  if (_cpu_perf_disabled) {
+    return workers;
+  }
+
+  double jvm_user_load = 0.0;
+  double jvm_kernel_load = 0.0;
+  double system_load = 0.0;
+
+  if (_cpu_perf == nullptr) {
+    _cpu_perf = new CPUPerformanceInterface();
+    if (!_cpu_perf->initialize()) {
+      log_debug(gc, ergo)("Elastic workers: CPU load not available");
+      delete _cpu_perf;
+      _cpu_perf = nullptr;
+      _cpu_perf_disabled = true;
+      return workers;
+    }
+    // The first sample after initialize() does not cover a meaningful
+    // interval. Take it only to start the sampling interval, and use all
+    // workers this time.
+    _cpu_perf->cpu_loads_process(&jvm_user_load, &jvm_kernel_load, &system_load);
+    return workers;
+  }
+
+  if (_cpu_perf->cpu_loads_process(&jvm_user_load, &jvm_kernel_load, &system_load) != OS_OK) {
+    return workers;
+  }
+
+  // The system load covers the interval since the previous sample, which
+  // spans earlier concurrent phases. It therefore includes the load of the
+  // GC workers themselves, besides the application and other processes on
+  // this machine, and errs towards fewer workers after busy GC cycles.
+  double idle = clamp(1.0 - system_load, 0.0, 1.0);
+  uint idle_cpus = (uint)ceil(idle * os::active_processor_count());
+  uint result = clamp(idle_cpus, 1u, workers);
+
+  log_debug(gc, ergo)("Elastic workers: using %u of %u workers, system CPU load %.1f%%",
+                      result, workers, system_load * 100.0);
+  return result;
+}
+
 uint ShenandoahWorkerPolicy::calc_workers_for_init_marking() {
   uint active_workers = (_prev_par_marking == 0) ? ParallelGCThreads : _prev_par_marking;
 
@@ -58,7 +122,7 @@ uint ShenandoahWorkerPolicy::calc_workers_for_conc_marking() {
     WorkerPolicy::calc_active_conc_workers(ConcGCThreads,
                                            active_workers,
                                            Threads::number_of_non_daemon_threads());
-  return _prev_conc_marking;
+  return elastic_conc_workers(_prev_conc_marking);
 }
 
 // Reuse the calculation result from init marking
@@ -93,7 +157,7 @@ uint ShenandoahWorkerPolicy::calc_workers_for_conc_evac() {
     WorkerPolicy::calc_active_conc_workers(ConcGCThreads,
                                            active_workers,
                                            Threads::number_of_non_daemon_threads());
-  return _prev_conc_evac;
+  return elastic_conc_workers(_prev_conc_evac);
 }
 
 // Calculate workers for parallel fullgc
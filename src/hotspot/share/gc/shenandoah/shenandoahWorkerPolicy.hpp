@@ -27,6 +27,8 @@
 
 #include "memory/allStatic.hpp"
 
+class CPUPerformanceInterface;
+
 class ShenandoahWorkerPolicy : AllStatic {
 private:
   static uint _prev_par_marking;
@@ -41,6 +43,15 @@ private:
   static uint _prev_conc_cleanup;
   static uint _prev_conc_reset;
 
+  static CPUPerformanceInterface* _cpu_perf;
+  // Set if the CPU load can not be sampled on this system.
+  static bool _cpu_perf_disabled;
+
+  // Limit the given number of concurrent workers to the number of CPUs that
+  // were not busy since the previous sample, unless the collector is about
+  // to run out of free heap.
+  static uint elastic_conc_workers(uint workers);
+
 public:
   // Calculate the number of workers for initial marking
   static uint calc_workers_for_init_marking();
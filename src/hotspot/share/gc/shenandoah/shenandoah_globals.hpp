@@ -243,6 +243,13 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  product(bool, ShenandoahElasticConcWorkers, false, EXPERIMENTAL,          \
+          "Limit the number of workers for concurrent marking and "         \
+          "evacuation to the number of CPUs not used by the application "   \
+          "or other processes when the concurrent phase starts. All "       \
+          "workers are used when free heap is below "                       \
+          "ShenandoahMinFreeThreshold.")                                    \
+                                                                            \
   product(bool, ShenandoahPacing, true, EXPERIMENTAL,                       \
           "Pace application allocations to give GC chance to start "        \
           "and complete before allocation failure is reached.")             \
@@ -22,17 +22,35 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zBarrierSetRuntime.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "oops/access.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 
+// The load barrier slow path is taken the first time a mutator loads a
+// field after the pointer colors have flipped, which makes it a cheap
+// sample of which objects are in active use. The recorded objects are
+// segregated from cold objects when their page is relocated.
+static zaddress sample_hot_object(zaddress addr) {
+  if (ZRelocateHotObjects && !is_null(addr)) {
+    ZPage* const page = ZHeap::heap()->page(addr);
+    if (page->is_small()) {
+      page->mark_object_hot(addr);
+    }
+  }
+
+  return addr;
+}
+
 JRT_LEAF(oopDesc*, ZBarrierSetRuntime::load_barrier_on_oop_field_preloaded(oopDesc* o, oop* p))
-  return to_oop(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o)));
+  return to_oop(sample_hot_object(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o))));
 JRT_END
 
 JRT_LEAF(zpointer, ZBarrierSetRuntime::load_barrier_on_oop_field_preloaded_store_good(oopDesc* o, oop* p))
-  return ZAddress::color(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o)), ZPointerStoreGoodMask);
+  return ZAddress::color(sample_hot_object(ZBarrier::load_barrier_on_oop_field_preloaded((zpointer*)p, to_zpointer(o))), ZPointerStoreGoodMask);
 JRT_END
 
 JRT_LEAF(oopDesc*, ZBarrierSetRuntime::load_barrier_on_weak_oop_field_preloaded(oopDesc* o, oop* p))
@@ -245,18 +245,12 @@ void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_a
     ZGeneration::young()->select_tenuring_threshold(selector.stats(), promote_all);
   }
 
-  // Install relocation set
-  _relocation_set.install(&selector);
+  // Install relocation set and setup forwarding table
+  _relocation_set.install(&selector, &_forwarding_table);
 
   // Flip age young pages that were not selected
   flip_age_pages(&selector);
 
-  // Setup forwarding table
-  ZRelocationSetIterator rs_iter(&_relocation_set);
-  for (ZForwarding* forwarding; rs_iter.next(&forwarding);) {
-    _forwarding_table.insert(forwarding);
-  }
-
   // Update statistics
   stat_relocation()->at_select_relocation_set(selector.stats());
   stat_heap()->at_select_relocation_set(selector.stats());
@@ -29,6 +29,7 @@
 #include "gc/z/zPhysicalMemory.inline.hpp"
 #include "gc/z/zRememberedSet.inline.hpp"
 #include "gc/z/zVirtualMemory.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/growableArray.hpp"
@@ -46,6 +47,8 @@ ZPage::ZPage(ZPageType type, const ZVirtualMemory& vmem, const ZPhysicalMemory&
     _remembered_set(),
     _last_used(0),
     _physical(pmem),
+    _hot_map(nullptr),
+    _hot_map_seqnum(0),
     _node() {
   assert(!_virtual.is_null(), "Should not be null");
   assert(!_physical.is_null(), "Should not be null");
@@ -56,6 +59,10 @@ ZPage::ZPage(ZPageType type, const ZVirtualMemory& vmem, const ZPhysicalMemory&
          "Page type/size mismatch");
 }
 
+ZPage::~ZPage() {
+  free_hot_map();
+}
+
 ZPage* ZPage::clone_limited() const {
   // Only copy type and memory layouts. Let the rest be lazily reconstructed when needed.
   return new ZPage(_type, _virtual, _physical);
@@ -138,6 +145,70 @@ void ZPage::reset_remembered_set() {
   }
 }
 
+CHeapBitMap* ZPage::hot_map_or_allocate() {
+  CHeapBitMap* const map = Atomic::load_acquire(&_hot_map);
+  if (map != nullptr) {
+    return map;
+  }
+
+  // Lazily allocated, only pages that have been accessed through
+  // the load barrier slow path pay for the hot map.
+  CHeapBitMap* const new_map = new CHeapBitMap(object_max_count(), mtGC);
+  CHeapBitMap* const prev_map = Atomic::cmpxchg(&_hot_map, (CHeapBitMap*)nullptr, new_map);
+  if (prev_map != nullptr) {
+    // Lost the race
+    delete new_map;
+    return prev_map;
+  }
+
+  return new_map;
+}
+
+void ZPage::age_hot_map(CHeapBitMap* map, uint32_t seqnum) {
+  const uint32_t prev_seqnum = Atomic::load(&_hot_map_seqnum);
+  if (prev_seqnum == seqnum || Atomic::cmpxchg(&_hot_map_seqnum, prev_seqnum, seqnum) != prev_seqnum) {
+    // Already aged by another mutator
+    return;
+  }
+
+  // The recorded accesses are from an earlier collection of the page's
+  // generation, drop them so that pages don't stay hot forever. Samples
+  // concurrently recorded by other mutators might be lost, which is fine.
+  map->clear();
+}
+
+void ZPage::free_hot_map() {
+  delete _hot_map;
+  _hot_map = nullptr;
+}
+
+void ZPage::reset_hot_map(ZPageResetType type) {
+  CHeapBitMap* const map = Atomic::load(&_hot_map);
+  if (map == nullptr) {
+    return;
+  }
+
+  switch (type) {
+  case ZPageResetType::Allocation:
+  case ZPageResetType::Splitting:
+    // No mutator can reach the page, safe to free
+    free_hot_map();
+    break;
+
+  case ZPageResetType::InPlaceRelocation:
+    // Objects are moved within the page, the recorded accesses no longer
+    // match the object starts. Mutators might still be setting bits, so
+    // the map is cleared rather than freed.
+    map->clear();
+    break;
+
+  case ZPageResetType::FlipAging:
+    // All objects stayed in place, keep the recorded accesses. They are
+    // aged out by the first sample of the next collection, see age_hot_map().
+    break;
+  }
+}
+
 void ZPage::reset(ZPageAge age, ZPageResetType type) {
   const ZPageAge prev_age = _age;
   _age = age;
@@ -157,6 +228,8 @@ void ZPage::reset(ZPageAge age, ZPageResetType type) {
   reset_remembered_set();
   verify_remset_after_reset(prev_age, type);
 
+  reset_hot_map(type);
+
   if (type != ZPageResetType::InPlaceRelocation || (prev_age != ZPageAge::old && age == ZPageAge::old)) {
     // Promoted in-place relocations reset the live map,
     // because they clone the page.
@@ -173,6 +246,7 @@ void ZPage::reset_type_and_size(ZPageType type) {
   _type = type;
   _livemap.resize(object_max_count());
   _remembered_set.resize(size());
+  free_hot_map();
 }
 
 ZPage* ZPage::retype(ZPageType type) {
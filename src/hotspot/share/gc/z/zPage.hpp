@@ -33,6 +33,7 @@
 #include "gc/z/zRememberedSet.hpp"
 #include "gc/z/zVirtualMemory.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/bitMap.hpp"
 
 class ZGeneration;
 
@@ -66,6 +67,8 @@ private:
   ZRememberedSet       _remembered_set;
   uint64_t             _last_used;
   ZPhysicalMemory      _physical;
+  CHeapBitMap* volatile _hot_map;
+  volatile uint32_t    _hot_map_seqnum;
   ZListNode<ZPage>     _node;
 
   ZPageType type_from_size(size_t size) const;
@@ -84,12 +87,19 @@ private:
   void reset_seqnum();
   void reset_remembered_set();
 
+  BitMap::idx_t hot_map_index(zaddress addr) const;
+  CHeapBitMap* hot_map_or_allocate();
+  void age_hot_map(CHeapBitMap* map, uint32_t seqnum);
+  void reset_hot_map(ZPageResetType type);
+  void free_hot_map();
+
   ZPage* split_with_pmem(ZPageType type, const ZPhysicalMemory& pmem);
 
   void verify_remset_after_reset(ZPageAge prev_age, ZPageResetType type);
 
 public:
   ZPage(ZPageType type, const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem);
+  ~ZPage();
 
   ZPage* clone_limited() const;
   ZPage* clone_limited_promote_flipped() const;
@@ -158,6 +168,11 @@ public:
   bool is_object_marked(zaddress addr, bool finalizable) const;
   bool mark_object(zaddress addr, bool finalizable, bool& inc_live);
 
+  // Objects accessed by mutators since the current collection of the page's
+  // generation started, see ZRelocateHotObjects
+  bool is_object_hot(zaddress addr) const;
+  void mark_object_hot(zaddress addr);
+
   void inc_live(uint32_t objects, size_t bytes);
   uint32_t live_objects() const;
   size_t live_bytes() const;
@@ -254,6 +254,10 @@ inline BitMap::idx_t ZPage::bit_index(zaddress addr) const {
   return (local_offset(addr) >> object_alignment_shift()) * 2;
 }
 
+inline BitMap::idx_t ZPage::hot_map_index(zaddress addr) const {
+  return local_offset(addr) >> object_alignment_shift();
+}
+
 inline zoffset ZPage::offset_from_bit_index(BitMap::idx_t index) const {
   const uintptr_t l_offset = ((index / 2) << object_alignment_shift());
   return start() + l_offset;
@@ -318,6 +322,34 @@ inline bool ZPage::mark_object(zaddress addr, bool finalizable, bool& inc_live)
   return _livemap.set(_generation_id, index, finalizable, inc_live);
 }
 
+inline bool ZPage::is_object_hot(zaddress addr) const {
+  assert(is_in(addr), "Invalid address");
+
+  const CHeapBitMap* const map = Atomic::load_acquire(&_hot_map);
+  return map != nullptr &&
+         Atomic::load(&_hot_map_seqnum) == generation()->seqnum() &&
+         map->at(hot_map_index(addr));
+}
+
+inline void ZPage::mark_object_hot(zaddress addr) {
+  assert(is_small(), "Only small pages track hot objects");
+  assert(is_in(addr), "Invalid address");
+
+  CHeapBitMap* const map = hot_map_or_allocate();
+  const uint32_t seqnum = generation()->seqnum();
+  if (Atomic::load(&_hot_map_seqnum) != seqnum) {
+    // First sample in this collection of the page's generation
+    age_hot_map(map, seqnum);
+  }
+
+  const BitMap::idx_t index = hot_map_index(addr);
+
+  // Avoid dirtying the cache line if the bit is already set
+  if (!map->at(index)) {
+    map->par_set_bit(index);
+  }
+}
+
 inline void ZPage::inc_live(uint32_t objects, size_t bytes) {
   _livemap.inc_live(objects, bytes);
 }
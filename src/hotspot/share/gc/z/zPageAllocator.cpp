@@ -31,6 +31,7 @@
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
@@ -52,6 +53,8 @@
 static const ZStatCounter       ZCounterMutatorAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterDefragment("Memory", "Defragment", ZStatUnitOpsPerSecond);
+static const ZStatCounter       ZCounterNUMALocalPageCommit("Memory", "NUMA Local Page Commit", ZStatUnitOpsPerSecond);
+static const ZStatCounter       ZCounterNUMARemotePageCommit("Memory", "NUMA Remote Page Commit", ZStatUnitOpsPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
 ZSafePageRecycle::ZSafePageRecycle(ZPageAllocator* page_allocator)
@@ -427,15 +430,6 @@ bool ZPageAllocator::commit_page(ZPage* page) {
   return _physical.commit(page->physical_memory());
 }
 
-void ZPageAllocator::uncommit_page(ZPage* page) {
-  if (!ZUncommit) {
-    return;
-  }
-
-  // Uncommit physical memory
-  _physical.uncommit(page->physical_memory());
-}
-
 void ZPageAllocator::map_page(const ZPage* page) const {
   // Map physical memory
   _physical.map(page->start(), page->physical_memory());
@@ -662,6 +656,19 @@ bool ZPageAllocator::is_alloc_satisfied(ZPageAllocation* allocation) const {
   return true;
 }
 
+void ZPageAllocator::update_numa_stats(ZPage* page) const {
+  if (!ZNUMA::is_enabled() || !page->is_small()) {
+    // Only small pages are expected to be used by a single thread
+    return;
+  }
+
+  if (page->numa_id() == ZNUMA::id()) {
+    ZStatInc(ZCounterNUMALocalPageCommit);
+  } else {
+    ZStatInc(ZCounterNUMARemotePageCommit);
+  }
+}
+
 ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
   // Fast path
   if (is_alloc_satisfied(allocation)) {
@@ -679,6 +686,7 @@ ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
   if (commit_page(page)) {
     // Success
     map_page(page);
+    update_numa_stats(page);
     return page;
   }
 
@@ -887,11 +895,30 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     Atomic::add(&_claimed, flushed);
   }
 
-  // Unmap, uncommit, and destroy flushed pages
-  ZListRemoveIterator<ZPage> iter(&pages);
+  // Unmap flushed pages and harvest their physical memory. Adjacent segments
+  // are merged, so that the memory can be uncommitted with as few calls as
+  // possible, instead of one call per segment of each page.
+  ZPhysicalMemory pmem;
+  ZListIterator<ZPage> iter(&pages);
   for (ZPage* page; iter.next(&page);) {
     unmap_page(page);
-    uncommit_page(page);
+
+    ZPhysicalMemory& fmem = page->physical_memory();
+    pmem.add_segments(fmem);
+    fmem.remove_segments();
+  }
+
+  log_debug(gc, heap)("Uncommitting " SIZE_FORMAT "M in %d segment(s)", flushed / M, pmem.nsegments());
+
+  // Uncommit and free harvested physical memory
+  if (ZUncommit) {
+    _physical.uncommit(pmem);
+  }
+  _physical.free(pmem);
+
+  // Destroy flushed pages
+  ZListRemoveIterator<ZPage> remove_iter(&pages);
+  for (ZPage* page; remove_iter.next(&page);) {
     destroy_page(page);
   }
 
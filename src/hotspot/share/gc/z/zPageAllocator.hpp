@@ -97,7 +97,6 @@ private:
   void decrease_used_generation(ZGenerationId id, size_t size);
 
   bool commit_page(ZPage* page);
-  void uncommit_page(ZPage* page);
 
   void map_page(const ZPage* page) const;
   void unmap_page(const ZPage* page) const;
@@ -113,6 +112,7 @@ private:
   bool should_defragment(const ZPage* page) const;
   bool is_alloc_satisfied(ZPageAllocation* allocation) const;
   ZPage* alloc_page_create(ZPageAllocation* allocation);
+  void update_numa_stats(ZPage* page) const;
   ZPage* alloc_page_finalize(ZPageAllocation* allocation);
   void free_pages_alloc_failed(ZPageAllocation* allocation);
 
@@ -215,11 +215,19 @@ void ZPageCache::flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZLis
   while (flush_list_inner(cl, from, to));
 }
 
-void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to) {
+void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to, bool local_first) {
   const uint32_t numa_count = ZNUMA::count();
   uint32_t numa_done = 0;
   uint32_t numa_next = 0;
 
+  if (local_first) {
+    // Flush the list of the local node first, so that the physical memory
+    // harvested from the flushed pages is likely local to the current thread
+    const uint32_t numa_id = ZNUMA::id();
+    flush_list(cl, from->addr(numa_id), to);
+    numa_next = numa_id + 1 == numa_count ? 0 : numa_id + 1;
+  }
+
   // Flush lists round-robin
   while (numa_done < numa_count) {
     ZList<ZPage>* const numa_list = from->addr(numa_next);
@@ -237,11 +245,11 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
   }
 }
 
-void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
+void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to, bool local_first) {
   // Prefer flushing large, then medium and last small pages
   flush_list(cl, &_large, to);
   flush_list(cl, &_medium, to);
-  flush_per_numa_lists(cl, &_small, to);
+  flush_per_numa_lists(cl, &_small, to, local_first);
 
   if (cl->_flushed > cl->_requested) {
     // Overflushed, re-insert part of last page into the cache
@@ -271,7 +279,7 @@ public:
 
 void ZPageCache::flush_for_allocation(size_t requested, ZList<ZPage>* to) {
   ZPageCacheFlushForAllocationClosure cl(requested);
-  flush(&cl, to);
+  flush(&cl, to, true /* local_first */);
 }
 
 class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
@@ -323,7 +331,7 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
   }
 
   ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
-  flush(&cl, to);
+  flush(&cl, to, false /* local_first */);
 
   return cl._flushed;
 }
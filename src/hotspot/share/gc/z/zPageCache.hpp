@@ -48,8 +48,8 @@ private:
 
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
-  void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
-  void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
+  void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to, bool local_first);
+  void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to, bool local_first);
 
 public:
   ZPageCache();
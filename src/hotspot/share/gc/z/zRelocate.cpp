@@ -455,6 +455,20 @@ public:
     return page;
   }
 
+  ZPage* alloc_and_retire_hot_target_page(ZForwarding* forwarding, ZPage* target) {
+    // Failing to allocate a hot target page doesn't lead to in-place
+    // relocation, the object is relocated to the normal target instead.
+    ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
+    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size());
+
+    if (target != nullptr) {
+      // Retire the old hot target page
+      retire_target_page(_generation, target);
+    }
+
+    return page;
+  }
+
   void share_target_page(ZPage* page) {
     // Does nothing
   }
@@ -541,6 +555,12 @@ public:
     return shared(to_age);
   }
 
+  ZPage* alloc_and_retire_hot_target_page(ZForwarding* forwarding, ZPage* target) {
+    // Hot objects are only segregated when relocating small pages
+    ShouldNotReachHere();
+    return nullptr;
+  }
+
   void share_target_page(ZPage* page) {
     const ZPageAge age = page->age();
 
@@ -578,6 +598,7 @@ private:
   Allocator* const   _allocator;
   ZForwarding*       _forwarding;
   ZPage*             _target[ZAllocator::_relocation_allocators];
+  ZPage*             _hot_target[ZAllocator::_relocation_allocators];
   ZGeneration* const _generation;
   size_t             _other_promoted;
   size_t             _other_compacted;
@@ -590,6 +611,14 @@ private:
     _target[static_cast<uint>(age) - 1] = page;
   }
 
+  ZPage* hot_target(ZPageAge age) {
+    return _hot_target[static_cast<uint>(age) - 1];
+  }
+
+  void set_hot_target(ZPageAge age, ZPage* page) {
+    _hot_target[static_cast<uint>(age) - 1] = page;
+  }
+
   size_t object_alignment() const {
     return (size_t)1 << _forwarding->object_alignment_shift();
   }
@@ -603,11 +632,10 @@ private:
     }
   }
 
-  zaddress try_relocate_object_inner(zaddress from_addr) {
+  zaddress try_relocate_object_inner(zaddress from_addr, ZPage* to_page) {
     ZForwardingCursor cursor;
 
     const size_t size = ZUtils::object_size(from_addr);
-    ZPage* const to_page = target(_forwarding->to_age());
 
     // Lookup forwarding
     {
@@ -811,8 +839,8 @@ private:
     update_remset_promoted(to_addr);
   }
 
-  bool try_relocate_object(zaddress from_addr) {
-    const zaddress to_addr = try_relocate_object_inner(from_addr);
+  bool try_relocate_object(zaddress from_addr, ZPage* to_page) {
+    const zaddress to_addr = try_relocate_object_inner(from_addr, to_page);
 
     if (is_null(to_addr)) {
       return false;
@@ -873,11 +901,38 @@ private:
     return to_page;
   }
 
+  bool should_relocate_hot_object(zaddress addr) const {
+    return ZRelocateHotObjects &&
+           _forwarding->type() == ZPageType::small &&
+           !_forwarding->in_place_relocation() &&
+           _forwarding->page()->is_object_hot(addr);
+  }
+
+  bool try_relocate_hot_object(zaddress addr) {
+    const ZPageAge to_age = _forwarding->to_age();
+    if (try_relocate_object(addr, hot_target(to_age))) {
+      return true;
+    }
+
+    // Allocate a new hot target page
+    ZPage* const to_page = _allocator->alloc_and_retire_hot_target_page(_forwarding, hot_target(to_age));
+    set_hot_target(to_age, to_page);
+
+    return to_page != nullptr && try_relocate_object(addr, to_page);
+  }
+
   void relocate_object(oop obj) {
     const zaddress addr = to_zaddress(obj);
     assert(ZHeap::heap()->is_object_live(addr), "Should be live");
 
-    while (!try_relocate_object(addr)) {
+    // Objects recently accessed by mutators are kept together, so that they
+    // share cache lines and pages. Fall back to the normal target page if
+    // no hot target page could be allocated.
+    if (should_relocate_hot_object(addr) && try_relocate_hot_object(addr)) {
+      return;
+    }
+
+    while (!try_relocate_object(addr, target(_forwarding->to_age()))) {
       // Allocate a new target page, or if that fails, use the page being
       // relocated as the new target, which will cause it to be relocated
       // in-place.
@@ -901,6 +956,7 @@ public:
     : _allocator(allocator),
       _forwarding(nullptr),
       _target(),
+      _hot_target(),
       _generation(generation),
       _other_promoted(0),
       _other_compacted(0) {}
@@ -908,6 +964,7 @@ public:
   ~ZRelocateWork() {
     for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
       _allocator->free_target_page(_target[i]);
+      _allocator->free_target_page(_hot_target[i]);
     }
     // Report statistics on-behalf of non-worker threads
     _generation->increase_promoted(_other_promoted);
@@ -26,6 +26,7 @@
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
+#include "gc/z/zForwardingTable.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
@@ -40,6 +41,7 @@
 class ZRelocationSetInstallTask : public ZTask {
 private:
   ZForwardingAllocator* const    _allocator;
+  ZForwardingTable* const        _forwarding_table;
   ZForwarding**                  _forwardings;
   const size_t                   _nforwardings;
   const ZArray<ZPage*>*          _small;
@@ -56,6 +58,10 @@ private:
 
     _forwardings[index] = forwarding;
 
+    // Forwardings cover disjoint ranges of the forwarding table,
+    // so they can be inserted in parallel
+    _forwarding_table->insert(forwarding);
+
     if (forwarding->is_promotion()) {
       // Before promoting an object (and before relocate start), we must ensure that all
       // contained zpointers are store good. The marking code ensures that for non-null
@@ -80,9 +86,12 @@ private:
   }
 
 public:
-  ZRelocationSetInstallTask(ZForwardingAllocator* allocator, const ZRelocationSetSelector* selector)
+  ZRelocationSetInstallTask(ZForwardingAllocator* allocator,
+                            ZForwardingTable* forwarding_table,
+                            const ZRelocationSetSelector* selector)
     : ZTask("ZRelocationSetInstallTask"),
       _allocator(allocator),
+      _forwarding_table(forwarding_table),
       _forwardings(nullptr),
       _nforwardings(selector->selected_small()->length() + selector->selected_medium()->length()),
       _small(selector->selected_small()),
@@ -151,9 +160,9 @@ ZArray<ZPage*>* ZRelocationSet::flip_promoted_pages() {
   return &_flip_promoted_pages;
 }
 
-void ZRelocationSet::install(const ZRelocationSetSelector* selector) {
-  // Install relocation set
-  ZRelocationSetInstallTask task(&_allocator, selector);
+void ZRelocationSet::install(const ZRelocationSetSelector* selector, ZForwardingTable* forwarding_table) {
+  // Install relocation set and setup forwarding table
+  ZRelocationSetInstallTask task(&_allocator, forwarding_table, selector);
   workers()->run(&task);
 
   _forwardings = task.forwardings();
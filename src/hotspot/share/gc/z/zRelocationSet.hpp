@@ -29,6 +29,7 @@
 #include "gc/z/zLock.hpp"
 
 class ZForwarding;
+class ZForwardingTable;
 class ZGeneration;
 class ZPage;
 class ZPageAllocator;
@@ -52,7 +53,7 @@ private:
 public:
   ZRelocationSet(ZGeneration* generation);
 
-  void install(const ZRelocationSetSelector* selector);
+  void install(const ZRelocationSetSelector* selector, ZForwardingTable* forwarding_table);
   void reset(ZPageAllocator* page_allocator);
   ZGeneration* generation() const;
   ZArray<ZPage*>* flip_promoted_pages();
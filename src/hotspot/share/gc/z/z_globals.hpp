@@ -47,6 +47,10 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(bool, ZRelocateHotObjects, false, EXPERIMENTAL,                   \
+          "Record objects accessed through the load barrier slow path "     \
+          "and relocate them to separate pages, away from cold objects")    \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
@@ -437,12 +437,17 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 }
 
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
-  // We use method->code_size() rather than method->identity_hash() below since
-  // the mark may not be present if a pointer to the method is already reversed.
-  return   ((unsigned int) bci)
-         ^ ((unsigned int) method->max_locals()         << 2)
-         ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+  // We use the address of the Method* rather than method->identity_hash() below
+  // since the mark may not be present if a pointer to the method is already
+  // reversed. Methods live in metaspace and never move, and the address tells
+  // apart methods of the same shape (max_locals, code_size, parameters) that
+  // used to collide here. The result is reduced to a table index so that it
+  // stays non-negative when the caller adds the probe offset.
+  uintptr_t m = (uintptr_t) method() >> LogBytesPerWord;
+  unsigned int h = ((unsigned int) bci)
+                 ^ ((unsigned int) m)
+                 ^ ((unsigned int) (m >> 7));
+  return h % _size;
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
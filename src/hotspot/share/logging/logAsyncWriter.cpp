@@ -79,8 +79,13 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The AsyncLog thread only waits while no data is available, so it has to
+  // be woken only by the enqueue that makes data available. Until it swaps
+  // the buffers, further messages just accumulate without signalling.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
@@ -187,11 +187,18 @@ Chunk::Chunk(size_t length) : _len(length) {
 }
 
 void Chunk::chop() {
+  if (ZapResourceArea) {
+    // clear out the chunks (to detect allocation bugs) before taking the lock
+    for (Chunk* k = this; k != nullptr; k = k->next()) {
+      memset(k->bottom(), badResourceValue, k->length());
+    }
+  }
+  // Hold ThreadCritical across the whole chain instead of taking it once
+  // per chunk; the pool and free paths in Chunk::operator delete re-enter it.
+  ThreadCritical tc;
   Chunk *k = this;
   while( k ) {
     Chunk *tmp = k->next();
-    // clear out this chunk (to detect allocation bugs)
-    if (ZapResourceArea) memset(k->bottom(), badResourceValue, k->length());
     delete k;                   // Free chunk (was malloc'd)
     k = tmp;
   }
@@ -409,6 +409,10 @@ void Method::remove_unshareable_info() {
 void Method::restore_unshareable_info(TRAPS) {
   assert(is_method() && is_valid_method(this), "ensure C++ vtable is restored");
   assert(!queued_for_compilation(), "method's queued_for_compilation flag should not be set");
+  if (_method_counters != nullptr) {
+    methodHandle mh(THREAD, this);
+    _method_counters->restore_unshareable_info(mh);
+  }
 }
 #endif
 
@@ -585,6 +589,12 @@ void Method::build_profiling_method_data(const methodHandle& method, TRAPS) {
     return;
   }
 
+  // Another thread may have installed the MDO since the caller checked;
+  // don't build and initialize one only to free it again below.
+  if (method->method_data() != nullptr) {
+    return;
+  }
+
   ClassLoaderData* loader_data = method->method_holder()->class_loader_data();
   MethodData* method_data = MethodData::allocate(loader_data, method, THREAD);
   if (HAS_PENDING_EXCEPTION) {
@@ -1167,6 +1177,9 @@ void Method::unlink_code() {
 // Called by class data sharing to remove any entry points (which are not shared)
 void Method::unlink_method() {
   Arguments::assert_is_dumping_archive();
+  // Remember which methods were hot enough for C2 when a dynamic archive is
+  // dumped at exit, so that they can be compiled early when it is used.
+  set_compiled_at_dump_time(_code != nullptr && _code->comp_level() == CompLevel_full_optimization);
   _code = nullptr;
   _adapter = nullptr;
   _i2i_entry = nullptr;
@@ -1180,7 +1193,10 @@ void Method::unlink_method() {
   NOT_PRODUCT(set_compiled_invocation_count(0);)
 
   set_method_data(nullptr);
-  clear_method_counters();
+  if (_method_counters != nullptr) {
+    // Only kept with ArchiveMethodCounters, see ArchiveBuilder::get_follow_mode().
+    _method_counters->remove_unshareable_info();
+  }
   remove_unshareable_flags();
 }
 
@@ -37,7 +37,10 @@ MethodCounters::MethodCounters(const methodHandle& mh) :
   JVMTI_ONLY(clear_number_of_breakpoints());
   invocation_counter()->init();
   backedge_counter()->init();
+  set_notify_masks(mh);
+}
 
+void MethodCounters::set_notify_masks(const methodHandle& mh) {
   // Set per-method thresholds.
   double scale = 1.0;
   CompilerOracle::has_option_value(mh, CompileCommand::CompileThresholdScaling, scale);
@@ -67,6 +70,23 @@ void MethodCounters::clear_counters() {
   set_highest_osr_comp_level(0);
 }
 
+#if INCLUDE_CDS
+void MethodCounters::remove_unshareable_info() {
+  set_interpreter_throwout_count(0);
+  JVMTI_ONLY(clear_number_of_breakpoints());
+  set_prev_time(0);
+  set_prev_event_count(0);
+  set_rate(0);
+  set_highest_comp_level(0);
+  set_highest_osr_comp_level(0);
+}
+
+void MethodCounters::restore_unshareable_info(const methodHandle& mh) {
+  // The notification frequencies may be scaled differently in this run.
+  set_notify_masks(mh);
+}
+#endif
+
 void MethodCounters::print_value_on(outputStream* st) const {
   assert(is_methodCounters(), "must be methodCounters");
   st->print("method counters");
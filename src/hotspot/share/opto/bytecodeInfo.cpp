@@ -114,7 +114,8 @@ static bool is_unboxing_method(ciMethod* callee_method, Compile* C) {
 
 // positive filter: should callee be inlined?
 bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
-                               int caller_bci, bool& should_delay, ciCallProfile& profile) {
+                               int caller_bci, JVMState* jvms, bool& should_delay,
+                               ciCallProfile& profile) {
   // Allows targeted inlining
   if (C->directive()->should_inline(callee_method)) {
     set_msg("force inline by CompileCommand");
@@ -183,6 +184,16 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
       return false;
     }
   }
+  if (size > max_inline_size && InlineConstantArgumentBonus > 0) {
+    // Constant arguments let parts of the callee fold away during parsing,
+    // so its bytecode size overestimates the size of the inlined code.
+    int con_args = count_constant_arguments(callee_method, jvms);
+    if (con_args > 0 &&
+        size <= max_inline_size + max_inline_size * con_args * InlineConstantArgumentBonus / 100) {
+      set_msg("inline (constant arguments)");
+      return true;
+    }
+  }
   if (size > max_inline_size) {
     if (max_inline_size > default_max_inline_size) {
       set_msg("hot method too big");
@@ -356,6 +367,26 @@ bool InlineTree::is_not_reached(ciMethod* callee_method, ciMethod* caller_method
   return true; // give up and treat the call site as not reached
 }
 
+// Count the arguments of the call that are constants. While the call is
+// parsed, the arguments are on top of the expression stack of the map.
+int InlineTree::count_constant_arguments(ciMethod* callee_method, JVMState* jvms) const {
+  SafePointNode* map = jvms->map();
+  int arg_size = callee_method->arg_size();
+  if (map == nullptr || jvms->argoff() + arg_size > jvms->monoff()) {
+    // Not at a call site being parsed, e.g. during incremental inlining.
+    return 0;
+  }
+  int count = 0;
+  for (int i = 0; i < arg_size; i++) {
+    Node* arg = map->argument(jvms, i);
+    // The second slot of a long or double is top.
+    if (arg->is_Con() && arg != C->top()) {
+      count++;
+    }
+  }
+  return count;
+}
+
 //-----------------------------try_to_inline-----------------------------------
 // return true if ok
 // Relocated from "InliningClosure::try_to_inline"
@@ -375,7 +406,7 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
   _forced_inline = false; // Reset
 
   // 'should_delay' can be overridden during replay compilation
-  if (!should_inline(callee_method, caller_method, caller_bci, should_delay, profile)) {
+  if (!should_inline(callee_method, caller_method, caller_bci, jvms, should_delay, profile)) {
     return false;
   }
   // 'should_delay' can be overridden during replay compilation
@@ -420,6 +420,12 @@
           "Maximum number of nodes")                                        \
           range(1000, max_jint / 3)                                         \
                                                                             \
+  product(uintx, C2CompileMemoryLimit, 0, EXPERIMENTAL,                     \
+          "If non-zero, a C2 compilation whose arenas grow beyond this "    \
+          "many megabytes is abandoned and the method is not compiled "     \
+          "by C2 again. 0 means no limit")                                  \
+          range(0, max_uintx / M)                                           \
+                                                                            \
   product(intx, NodeLimitFudgeFactor, 2000,                                 \
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
@@ -591,6 +597,11 @@
   develop(bool, InlineAccessors, true,                                      \
           "inline accessor methods (get/set)")                              \
                                                                             \
+  product(intx, InlineConstantArgumentBonus, 0, EXPERIMENTAL,               \
+          "Percentage by which the inline size limit of a call site grows " \
+          "for each argument that is a constant at the call site")          \
+          range(0, 1000)                                                    \
+                                                                            \
   product(intx, TypeProfileMajorReceiverPercent, 90,                        \
           "% of major receiver type to all profiled receivers")             \
           range(0, 100)                                                     \
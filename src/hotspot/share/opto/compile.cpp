@@ -850,6 +850,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
   // Now optimize
   Optimize();
   if (failing())  return;
+  if (check_memory_limit("out of memory after optimizations"))  return;
   NOT_PRODUCT( verify_graph_edges(); )
 
 #ifndef PRODUCT
@@ -882,6 +883,12 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
 
   // Now generate code
   Code_Gen();
+
+  // Capture slow compilations so they can be replayed and analyzed offline.
+  // Done here while the compiler data for the inlining records is still set.
+  if (!failing() && !directive->DumpReplayOption && env()->exceeds_replay_compile_time_threshold()) {
+    env()->dump_replay_data(_compile_id);
+  }
 }
 
 //------------------------------Compile----------------------------------------
@@ -2160,6 +2167,22 @@ void Compile::process_late_inline_calls_no_inline(PhaseIterGVN& igvn) {
   }
 }
 
+bool Compile::check_memory_limit(const char* reason) {
+  if (C2CompileMemoryLimit == 0) {
+    return false;
+  }
+  size_t footprint = _comp_arena.size_in_bytes() +
+                     _node_arena_one.size_in_bytes() +
+                     _node_arena_two.size_in_bytes() +
+                     _Compile_types.size_in_bytes() +
+                     Thread::current()->resource_area()->size_in_bytes();
+  if (footprint > C2CompileMemoryLimit * M) {
+    record_method_not_compilable(reason);
+    return true;
+  }
+  return false;
+}
+
 bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
   if (_loop_opts_cnt > 0) {
     while (major_progress() && (_loop_opts_cnt > 0)) {
@@ -2167,6 +2190,7 @@ bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
       PhaseIdealLoop::optimize(igvn, mode);
       _loop_opts_cnt--;
       if (failing())  return false;
+      if (check_memory_limit("out of memory during loop optimizations"))  return false;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP_ITERATIONS, 2);
     }
   }
@@ -2912,6 +2936,9 @@ void Compile::Code_Gen() {
   if (failing()) {
     return;
   }
+  if (check_memory_limit("out of memory matching instructions")) {
+    return;
+  }
 
   print_method(PHASE_MATCHING, 2);
 
@@ -809,6 +809,8 @@ private:
       return false;
     }
   }
+  // Fail the compilation if its arenas have grown beyond C2CompileMemoryLimit.
+  bool check_memory_limit(const char* reason);
 
   // Node management
   uint         unique() const              { return _unique; }
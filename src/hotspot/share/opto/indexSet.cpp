@@ -111,6 +111,10 @@ IndexSet::BitBlock *IndexSet::alloc_block() {
 IndexSet::BitBlock *IndexSet::alloc_block_containing(uint element) {
   BitBlock *block = alloc_block();
   uint bi = get_block_index(element);
+  // Entries of the top level array are initialized lazily, see initialize().
+  for (uint i = _current_block_limit; i < bi; i++) {
+    set_block(i, &_empty_block);
+  }
   if (bi >= _current_block_limit) {
     _current_block_limit = bi + 1;
   }
@@ -235,7 +239,7 @@ IndexSet::IndexSet (IndexSet *set) {
     _blocks =
       (IndexSet::BitBlock**) arena()->AmallocWords(sizeof(IndexSet::BitBlock**) * _max_blocks);
   }
-  for (uint i = 0; i < _max_blocks; i++) {
+  for (uint i = 0; i < _current_block_limit; i++) {
     BitBlock *block = set->_blocks[i];
     if (block == &_empty_block) {
       set_block(i, &_empty_block);
@@ -265,9 +269,9 @@ void IndexSet::initialize(uint max_elements) {
   } else {
     _blocks = (IndexSet::BitBlock**) arena()->AmallocWords(sizeof(IndexSet::BitBlock*) * _max_blocks);
   }
-  for (uint i = 0; i < _max_blocks; i++) {
-    set_block(i, &_empty_block);
-  }
+  // The entries of the top level array are only filled in up to the highest
+  // block in use (see alloc_block_containing()), so that initializing the
+  // sets of a large universe does not take time quadratic in its size.
 }
 
 //---------------------------- IndexSet::initialize()------------------------------
@@ -290,9 +294,7 @@ void IndexSet::initialize(uint max_elements, Arena *arena) {
   } else {
     _blocks = (IndexSet::BitBlock**) arena->AmallocWords(sizeof(IndexSet::BitBlock*) * _max_blocks);
   }
-  for (uint i = 0; i < _max_blocks; i++) {
-    set_block(i, &_empty_block);
-  }
+  // The top level array is filled in lazily, as in initialize(uint) above.
 }
 
 //---------------------------- IndexSet::swap() -----------------------------
@@ -344,7 +346,7 @@ void IndexSet::dump() const {
 void IndexSet::tally_iteration_statistics() const {
   inc_stat_counter(&_total_bits, count());
 
-  for (uint i = 0; i < _max_blocks; i++) {
+  for (uint i = 0; i < _current_block_limit; i++) {
     if (_blocks[i] != &_empty_block) {
       inc_stat_counter(&_total_used_blocks, 1);
     } else {
@@ -227,10 +227,15 @@ class IndexSet : public ResourceObj {
  private:
   //-------------------------- Utility methods -----------------------------------
 
-  // Get the block which holds element
+  // Get the block which holds element. Only the entries below
+  // _current_block_limit of the top level array are initialized.
   BitBlock *get_block_containing(uint element) const {
     assert(element < _max_elements, "element out of bounds");
-    return _blocks[get_block_index(element)];
+    uint bi = get_block_index(element);
+    if (bi >= _current_block_limit) {
+      return &_empty_block;
+    }
+    return _blocks[bi];
   }
 
   // Set a block in the top level array
@@ -76,8 +76,11 @@ protected:
   bool        should_inline(ciMethod* callee_method,
                             ciMethod* caller_method,
                             int caller_bci,
+                            JVMState* jvms,
                             bool& should_delay,
                             ciCallProfile& profile);
+  int         count_constant_arguments(ciMethod* callee_method,
+                                       JVMState* jvms) const;
   bool        should_not_inline(ciMethod* callee_method,
                                 ciMethod* caller_method,
                                 int caller_bci,
@@ -2006,6 +2006,34 @@ void SuperWord::filter_packs() {
 #endif
 }
 
+//------------------------------reduction_moves_out_of_loop---------------------------
+// Follow the reduction cycle of n back to its phi. The unordered reductions of
+// the cycle are replaced by vector operations on a vector accumulator in
+// PhaseIdealLoop::move_unordered_reduction_out_of_loop if the phi has no other
+// use, and if the matching vector operation is implemented.
+bool SuperWord::reduction_moves_out_of_loop(Node* n) {
+  assert(is_marked_reduction(n), "must be a reduction");
+  BasicType bt = n->bottom_type()->basic_type();
+  if (bt != T_INT && bt != T_LONG) {
+    // Floating point reductions are ordered and stay in the loop.
+    return false;
+  }
+  Node* current = n;
+  while (is_marked_reduction(current)) {
+    // Reduction definitions and the phi feed the first operand, see opnd_positions_match().
+    Node* first = current->in(1);
+    if (!first->is_Phi() && !is_marked_reduction(first)) {
+      first = current->in(2);
+    }
+    current = first;
+  }
+  if (!current->is_Phi() || current->in(0) != lp() || current->outcnt() != 1) {
+    return false;
+  }
+  int vopc = VectorNode::opcode(n->Opcode(), bt);
+  return vopc > 0 && Matcher::match_rule_supported_vector(vopc, 2, bt);
+}
+
 //------------------------------implemented---------------------------
 // Can code be generated for pack p?
 bool SuperWord::implemented(Node_List* p) {
@@ -2017,7 +2045,11 @@ bool SuperWord::implemented(Node_List* p) {
     if (is_marked_reduction(p0)) {
       const Type *arith_type = p0->bottom_type();
       // Length 2 reductions of INT/LONG do not offer performance benefits
-      if (((arith_type->basic_type() == T_INT) || (arith_type->basic_type() == T_LONG)) && (size == 2)) {
+      // while they stay in the loop: the reduction takes more instructions
+      // than the two scalar operations it replaces. After they are moved out
+      // of the loop only a plain vector operation remains in the loop body.
+      if (((arith_type->basic_type() == T_INT) || (arith_type->basic_type() == T_LONG)) && (size == 2) &&
+          !reduction_moves_out_of_loop(p0)) {
         retValue = false;
       } else {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
@@ -3039,13 +3071,15 @@ Node* SuperWord::create_post_loop_vmask() {
     default: return nullptr;
   }
 
-  // Currently we can't remove this MaxVectorSize constraint. Without it,
+  // Currently we can't remove this vector size constraint. Without it,
   // it's not guaranteed that the RCE'd post loop runs at most "vlen - 1"
   // iterations, because the vector drain loop may not be cloned from the
   // vectorized main loop. We should re-engineer PostLoopMultiversioning
-  // to fix this problem.
+  // to fix this problem. Compare with the widest vector SuperWord uses for
+  // the element type rather than MaxVectorSize, which may be larger (e.g.
+  // on Cascade Lake auto vectorization is limited to 256 bits).
   int vlen = cl->slp_max_unroll();
-  if (unique_size * vlen != MaxVectorSize) {
+  if (vlen != Matcher::superword_max_vector_size(vmask_bt)) {
     return nullptr;
   }
 
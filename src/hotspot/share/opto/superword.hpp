@@ -585,6 +585,9 @@ private:
   Node* vector_opd(Node_List* p, int opd_idx);
   // Can code be generated for pack p?
   bool implemented(Node_List* p);
+  // Is the reduction cycle of n expected to be turned into a vector accumulator
+  // by PhaseIdealLoop::move_unordered_reduction_out_of_loop?
+  bool reduction_moves_out_of_loop(Node* n);
   // For pack p, are all operands and all uses (with in the block) vector?
   bool profitable(Node_List* p);
   // If a use of pack p is not a vector use, then replace the use with an extract operation.
@@ -2825,6 +2825,12 @@ JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jbool
   oop s = JNIHandles::resolve_non_null(string);
   jchar* ret;
   if (!java_lang_String::is_latin1(s)) {
+    // The GC keeps the memory of pinned objects valid only while they stay
+    // live, so prevent string deduplication from replacing the value array
+    // while it is exposed.
+    if (StringDedup::is_enabled()) {
+      StringDedup::forbid_deduplication(s);
+    }
     typeArrayHandle s_value(thread, java_lang_String::value(s));
 
     // Pin value array
@@ -2861,8 +2867,8 @@ JNI_ENTRY(void, jni_ReleaseStringCritical(JNIEnv *env, jstring str, const jchar
     // This assumes that ReleaseStringCritical bookends GetStringCritical.
     FREE_C_HEAP_ARRAY(jchar, chars);
   } else {
-    // StringDedup can have replaced the value array, so don't fetch the array from 's'.
-    // Instead, we calculate the address based on the jchar array exposed with GetStringCritical.
+    // GetStringCritical forbade deduplication of 's', but calculate the address based
+    // on the jchar array exposed with GetStringCritical rather than fetching it from 's'.
     oop value = cast_to_oop((address)chars - arrayOopDesc::base_offset_in_bytes(T_CHAR));
 
     // Unpin value array
@@ -273,7 +273,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+  AdjustAndCleanMetadata adjust_and_clean_metadata(current, _class_count, _class_defs);
   ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
 
   // JSR-292 support
@@ -3737,6 +3737,15 @@ void VM_RedefineClasses::set_new_constant_pool(
 // to fix up these pointers.  MethodData also points to old methods and
 // must be cleaned.
 
+bool VM_RedefineClasses::AdjustAndCleanMetadata::is_subtype_of_redefined(InstanceKlass* ik) const {
+  for (int i = 0; i < _class_count; i++) {
+    if (ik->is_subtype_of(get_ik(_class_defs[i].klass))) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Adjust cpools and vtables closure
 void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
@@ -3767,14 +3776,20 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
     }
 
     // Adjust all vtables, default methods and itables, to clean out old methods.
-    ResourceMark rm(_thread);
-    if (ik->vtable_length() > 0) {
-      ik->vtable().adjust_method_entries(&trace_name_printed);
-      ik->adjust_default_methods(&trace_name_printed);
-    }
+    // These only hold methods of the class and its supertypes, and the old
+    // methods of earlier redefinitions have already been cleaned out of them,
+    // so classes that are not subtypes of a class being redefined now can
+    // be skipped.
+    if (is_subtype_of_redefined(ik)) {
+      ResourceMark rm(_thread);
+      if (ik->vtable_length() > 0) {
+        ik->vtable().adjust_method_entries(&trace_name_printed);
+        ik->adjust_default_methods(&trace_name_printed);
+      }
 
-    if (ik->itable_length() > 0) {
-      ik->itable().adjust_method_entries(&trace_name_printed);
+      if (ik->itable_length() > 0) {
+        ik->itable().adjust_method_entries(&trace_name_printed);
+      }
     }
 
     // The constant pools in other classes (other_cp) can refer to
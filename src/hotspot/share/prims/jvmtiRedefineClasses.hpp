@@ -517,8 +517,14 @@ class VM_RedefineClasses: public VM_Operation {
   // to fix up these pointers and clean MethodData out.
   class AdjustAndCleanMetadata : public KlassClosure {
     Thread* _thread;
+    jint                        _class_count;
+    const jvmtiClassDefinition* _class_defs;
+    // Only subtypes of a redefined class can have its methods
+    // in their vtables, itables or default methods.
+    bool is_subtype_of_redefined(InstanceKlass* ik) const;
    public:
-    AdjustAndCleanMetadata(Thread* t) : _thread(t) {}
+    AdjustAndCleanMetadata(Thread* t, jint class_count, const jvmtiClassDefinition* class_defs) :
+      _thread(t), _class_count(class_count), _class_defs(class_defs) {}
     void do_klass(Klass* k);
   };
 
@@ -692,6 +692,13 @@ const int ObjectAlignmentInBytes = 8;
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
                                                                             \
+  product(uint, BootLoaderMissingClassCacheSize, 0, EXPERIMENTAL,           \
+          "Number of entries, rounded up to a power of 2, in a cache of "   \
+          "class names the boot loader failed to find. Repeated lookups "   \
+          "of such names skip searching the runtime image and class "       \
+          "path. 0 disables the cache")                                     \
+          range(0, 1*M)                                                     \
+                                                                            \
   product_pd(bool, DontYieldALot,                                           \
           "Throw away obvious excess yield calls")                          \
                                                                             \
@@ -741,6 +748,21 @@ const int ObjectAlignmentInBytes = 8;
           "before adjusting the in_use_list_ceiling up (0 is off).")        \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, MonitorDeflationSecondChance, false, DIAGNOSTIC,            \
+          "Skip async deflation of an idle monitor once if it was "         \
+          "contended since the previous deflation cycle")                   \
+                                                                            \
+  product(uint, MonitorNUMAHandoffScanDepth, 0, EXPERIMENTAL,               \
+          "When UseNUMA is on, search this many entry-queue waiters of "    \
+          "an exiting monitor owner for one on the owner's NUMA node and "  \
+          "wake it first (0 is off)")                                       \
+          range(0, 64)                                                      \
+                                                                            \
+  product(int, MonitorNUMAHandoffLimit, 16, EXPERIMENTAL,                   \
+          "Maximum number of consecutive NUMA-local monitor handoffs "      \
+          "that skip the head of the entry queue")                          \
+          range(1, max_jint)                                                \
+                                                                            \
   product(intx, hashCode, 5, EXPERIMENTAL,                                  \
                "(Unstable) select hashCode generation algorithm")           \
                                                                             \
@@ -961,6 +983,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseNotificationThread, true,                                \
           "Use Notification Thread")                                        \
                                                                             \
+  product(uint, TrimNativeHeapAfterGCInterval, 0, EXPERIMENTAL,             \
+          "If non-zero, the service thread trims the C-heap after a "       \
+          "garbage collection, at most once per this many milliseconds. "   \
+          "0 disables trimming after GC.")                                  \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -1285,6 +1313,10 @@ const int ObjectAlignmentInBytes = 8;
           "exceptions (0 means all)")                                       \
           range(0, max_jint/2)                                              \
                                                                             \
+  product(bool, ThreadDumpUsingHandshakes, false, EXPERIMENTAL,             \
+          "Take stack traces for Thread.getAllStackTraces() with a "        \
+          "handshake per thread instead of a safepoint")                    \
+                                                                            \
   /* notice: the max range value here is max_jint, not max_intx  */         \
   /* because of overflow issue                                   */         \
   product(intx, GuaranteedSafepointInterval, 1000, DIAGNOSTIC,              \
@@ -1296,6 +1328,12 @@ const int ObjectAlignmentInBytes = 8;
           "Delay in milliseconds for option SafepointTimeout")              \
           range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
                                                                             \
+  product(intx, SafepointSyncReportDelay, 0, DIAGNOSTIC,                    \
+          "Log the last thread to reach a safepoint and the Java method "   \
+          "it stopped in when synchronization takes at least this many "    \
+          "milliseconds (0 is off)")                                        \
+          range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
+                                                                            \
   product(bool, UseSystemMemoryBarrier, false,                              \
           "Try to enable system memory barrier if supported by OS")         \
                                                                             \
@@ -1881,6 +1919,10 @@ const int ObjectAlignmentInBytes = 8;
   product(uint64_t, StringDeduplicationHashSeed, 0, DIAGNOSTIC,             \
           "Seed for the table hashing function; 0 requests computed seed")  \
                                                                             \
+  product(uint, StringDeduplicationThreads, 1, EXPERIMENTAL,                \
+          "Number of threads processing deduplication requests")            \
+          range(1, 64)                                                      \
+                                                                            \
   product(bool, WhiteBoxAPI, false, DIAGNOSTIC,                             \
           "Enable internal testing APIs")                                   \
                                                                             \
@@ -1942,6 +1984,13 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(int, ContinuationThawAllThreshold, 500, EXPERIMENTAL,             \
+          "Thaw all frames of a stack chunk at once if the chunk is "       \
+          "smaller than this many words, otherwise thaw only the top "      \
+          "frame and leave the rest to the return barrier (0 is always "    \
+          "one frame)")                                                     \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(int, VerifyMetaspaceInterval, DEBUG_ONLY(500) NOT_DEBUG(0),       \
                "Run periodic metaspace verifications (0 - none, "           \
                "1 - always, >1 every nth interval)")                        \
@@ -645,32 +645,40 @@ HandshakeState::ProcessResult HandshakeState::try_process(HandshakeOperation* ma
   }
 
   Thread* current_thread = Thread::current();
+  bool executed_match_op = false;
 
-  HandshakeOperation* op = get_op();
+  // The handshakee cannot leave its safe state while we hold the mutex, so
+  // execute all operations pending for it in one pass instead of claiming
+  // it again for each of them.
+  do {
+    HandshakeOperation* op = get_op();
 
-  assert(op != nullptr, "Must have an op");
-  assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
-  assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
+    assert(op != nullptr, "Must have an op");
+    assert(SafepointMechanism::local_poll_armed(_handshakee), "Must be");
+    assert(op->_target == nullptr || _handshakee == op->_target, "Wrong thread");
 
-  log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
-                       op == match_op ? "handshaker" : "cooperative",
-                       current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
+    log_trace(handshake)("Processing handshake " INTPTR_FORMAT " by %s(%s)", p2i(op),
+                         op == match_op ? "handshaker" : "cooperative",
+                         current_thread->is_VM_thread() ? "VM Thread" : "JavaThread");
 
-  op->prepare(_handshakee, current_thread);
+    op->prepare(_handshakee, current_thread);
 
-  set_active_handshaker(current_thread);
-  op->do_handshake(_handshakee); // acquire, op removed after
-  set_active_handshaker(nullptr);
-  remove_op(op);
+    set_active_handshaker(current_thread);
+    op->do_handshake(_handshakee); // acquire, op removed after
+    set_active_handshaker(nullptr);
+    remove_op(op);
+
+    executed_match_op |= (op == match_op);
+  } while (have_non_self_executable_operation());
 
   _lock.unlock();
 
-  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed an op for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
+  log_trace(handshake)("%s(" INTPTR_FORMAT ") executed ops for JavaThread: " INTPTR_FORMAT " %s target op: " INTPTR_FORMAT,
                        current_thread->is_VM_thread() ? "VM Thread" : "JavaThread",
                        p2i(current_thread), p2i(_handshakee),
-                       op == match_op ? "including" : "excluding", p2i(match_op));
+                       executed_match_op ? "including" : "excluding", p2i(match_op));
 
-  return op == match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
+  return executed_match_op ? HandshakeState::_succeeded : HandshakeState::_processed;
 }
 
 void HandshakeState::do_self_suspend() {
@@ -46,6 +46,7 @@
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/safefetch.hpp"
@@ -270,6 +271,8 @@ ObjectMonitor::ObjectMonitor(oop object) :
   _Spinner(0),
   _SpinDuration(ObjectMonitor::Knob_SpinLimit),
   _contentions(0),
+  _recently_contended(false),
+  _local_handoffs(0),
   _WaitSet(nullptr),
   _waiters(0),
   _WaitSetLock(0)
@@ -348,6 +351,12 @@ bool ObjectMonitor::enter(JavaThread* current) {
   assert(current->_Stalled == 0, "invariant");
   current->_Stalled = intptr_t(this);
 
+  if (MonitorDeflationSecondChance && !_recently_contended) {
+    // Hint to async deflation that this monitor is likely to be
+    // re-inflated soon after being deflated.
+    Atomic::store(&_recently_contended, true);
+  }
+
   // Try one round of spinning *before* enqueueing current
   // and before going through the awkward and expensive state
   // transitions.  The following spin is strictly optional ...
@@ -560,6 +569,20 @@ bool ObjectMonitor::deflate_monitor() {
       return false;
     }
 
+    if (Atomic::load(&_recently_contended)) {
+      // The monitor was contended since the last deflation cycle and
+      // would be deflated now. Give it a second chance instead of having
+      // the next contended enter() inflate a fresh one. The hint is only
+      // set again by contention, so a monitor that stays idle is deflated
+      // next time. Restore owner to null if it is still DEFLATER_MARKER:
+      Atomic::store(&_recently_contended, false);
+      if (try_set_owner_from(DEFLATER_MARKER, nullptr) != DEFLATER_MARKER) {
+        // Deferred decrement for the JT EnterI() that cancelled the async deflation.
+        add_to_contentions(-1);
+      }
+      return false;
+    }
+
     // Make a zero contentions field negative to force any contending threads
     // to retry. This is the second part of the async deflation dance.
     if (Atomic::cmpxchg(&_contentions, 0, INT_MIN) != 0) {
@@ -1259,7 +1282,7 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
       // Given all that, we have to tolerate the circumstance where "w" is
       // associated with current.
       assert(w->TState == ObjectWaiter::TS_ENTER, "invariant");
-      ExitEpilog(current, w);
+      ExitEpilog(current, SelectSuccessor(w));
       return;
     }
 
@@ -1311,12 +1334,39 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
     w = _EntryList;
     if (w != nullptr) {
       guarantee(w->TState == ObjectWaiter::TS_ENTER, "invariant");
-      ExitEpilog(current, w);
+      ExitEpilog(current, SelectSuccessor(w));
       return;
     }
   }
 }
 
+// Pick the EntryList thread to wake. Normally that is the head. With
+// MonitorNUMAHandoffScanDepth the first few entries are searched for a
+// waiter on the exiting thread's NUMA node, so that the lock and the data
+// it protects stay in the same node's caches (cohort locking). The woken
+// thread unlinks itself in UnlinkAfterAcquire(), so any entry may be picked.
+ObjectWaiter* ObjectMonitor::SelectSuccessor(ObjectWaiter* head) {
+  if (MonitorNUMAHandoffScanDepth == 0 || !UseNUMA || head->_next == nullptr) {
+    return head;
+  }
+  if (_local_handoffs >= MonitorNUMAHandoffLimit) {
+    // Pass the lock to the head to let waiters on other nodes make progress.
+    _local_handoffs = 0;
+    return head;
+  }
+  const int lgrp_id = os::numa_get_group_id();
+  uint depth = 0;
+  for (ObjectWaiter* w = head; w != nullptr && depth < MonitorNUMAHandoffScanDepth;
+       w = w->_next, depth++) {
+    if (w->_lgrp_id == lgrp_id) {
+      _local_handoffs = (w == head) ? 0 : _local_handoffs + 1;
+      return w;
+    }
+  }
+  _local_handoffs = 0;
+  return head;
+}
+
 void ObjectMonitor::ExitEpilog(JavaThread* current, ObjectWaiter* Wakee) {
   assert(owner_raw() == current, "invariant");
 
@@ -2064,6 +2114,7 @@ ObjectWaiter::ObjectWaiter(JavaThread* current) {
   _thread   = current;
   _event    = _thread->_ParkEvent;
   _active   = false;
+  _lgrp_id  = (MonitorNUMAHandoffScanDepth > 0 && UseNUMA) ? os::numa_get_group_id() : -1;
   assert(_event != nullptr, "invariant");
 }
 
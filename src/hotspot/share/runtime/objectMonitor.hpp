@@ -51,6 +51,7 @@ class ObjectWaiter : public StackObj {
   volatile int  _notified;
   volatile TStates TState;
   bool          _active;           // Contention monitoring is enabled
+  int           _lgrp_id;          // NUMA node of _thread, see MonitorNUMAHandoffScanDepth
  public:
   ObjectWaiter(JavaThread* current);
 
@@ -185,6 +186,11 @@ private:
                                     // along with other fields to determine if an ObjectMonitor can be
                                     // deflated. It is also used by the async deflation protocol. See
                                     // ObjectMonitor::deflate_monitor().
+  volatile bool _recently_contended; // Set by a contended enter(); lets an idle monitor
+                                    // survive one async deflation cycle when
+                                    // MonitorDeflationSecondChance is enabled.
+  int _local_handoffs;              // Consecutive NUMA-local successor picks, bounded
+                                    // to keep remote waiters from starving.
  protected:
   ObjectWaiter* volatile _WaitSet;  // LL of threads wait()ing on the monitor
   volatile int  _waiters;           // number of waiting threads
@@ -358,6 +364,7 @@ private:
   int       TryLock(JavaThread* current);
   int       NotRunnable(JavaThread* current, JavaThread* Owner);
   int       TrySpin(JavaThread* current);
+  ObjectWaiter* SelectSuccessor(ObjectWaiter* head);
   void      ExitEpilog(JavaThread* current, ObjectWaiter* Wakee);
 
   // Deflation support
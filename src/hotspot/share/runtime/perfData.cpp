@@ -36,6 +36,7 @@
 #include "runtime/perfData.inline.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 PerfDataList*   PerfDataManager::_all = nullptr;
 PerfDataList*   PerfDataManager::_sampled = nullptr;
@@ -528,6 +529,26 @@ PerfDataList* PerfDataList::clone() {
   return copy;
 }
 
+PerfHistogram* PerfHistogram::create(CounterNS ns, const char* name, TRAPS) {
+  PerfHistogram* h = new PerfHistogram();
+  for (int i = 0; i < num_buckets; i++) {
+    char bucket_name[128];
+    os::snprintf_checked(bucket_name, sizeof(bucket_name), "%s.%02d", name, i);
+    h->_buckets[i] = PerfDataManager::create_counter(ns, bucket_name,
+                                                     PerfData::U_Events, CHECK_NULL);
+  }
+  return h;
+}
+
+void PerfHistogram::record(jlong ticks) {
+  jlong micros = (jlong)(TimeHelper::counter_to_seconds(ticks) * MICROUNITS);
+  int bucket = 0;
+  if (micros > 0) {
+    bucket = MIN2(log2i(micros) + 1, num_buckets - 1);
+  }
+  _buckets[bucket]->inc();
+}
+
 PerfTraceTime::~PerfTraceTime() {
   if (!UsePerfData) return;
   _t.stop();
@@ -802,6 +802,37 @@ class PerfDataManager : AllStatic {
 
 // Utility Classes
 
+/*
+ * The PerfHistogram class counts event durations in log2-sized
+ * microsecond buckets, backed by one PerfCounter per bucket, so that
+ * external readers of the hsperfdata file can obtain a latency
+ * distribution and not only an accumulated time. A duration of d
+ * microseconds is counted in bucket 0 if d < 1, in bucket i if
+ * 2^(i-1) <= d < 2^i, and in the last bucket if it is longer than that.
+ *
+ * Example:
+ *
+ *    PerfHistogram* h = PerfHistogram::create(SUN_RT, "foo.histogram", CHECK);
+ *    h->record(elapsed_ticks);
+ *
+ * Like PerfCounter::inc(), record() is not MT-safe.
+ */
+class PerfHistogram : public CHeapObj<mtInternal> {
+  public:
+    static const int num_buckets = 24;
+
+  private:
+    PerfCounter* _buckets[num_buckets];
+
+    PerfHistogram() {}
+
+  public:
+    static PerfHistogram* create(CounterNS ns, const char* name, TRAPS);
+
+    // record a duration given in os::elapsed_counter() ticks
+    void record(jlong ticks);
+};
+
 /*
  * this class will administer a PerfCounter used as a time accumulator
  * for a basic block much like the TraceTime class.
@@ -24,7 +24,6 @@
 
 #include "precompiled.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
-#include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "code/codeCache.hpp"
 #include "code/icBuffer.hpp"
@@ -40,6 +39,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -67,6 +67,7 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.inline.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -105,6 +106,53 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
   }
 }
 
+static void post_safepoint_last_thread_event(EventSafepointLastThread& event,
+                                             uint64_t safepoint_id,
+                                             JavaThread* thread,
+                                             Method* method,
+                                             int bci) {
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_lastThread(JFR_JVM_THREAD_ID(thread));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.commit();
+  }
+}
+
+// Report the last thread to reach the safepoint together with the Java
+// method it stopped in. That thread determined the time to safepoint, so
+// its location usually points just past the loop or call that ran without
+// polling.
+static void report_last_to_arrive(JavaThread* thread, EventSafepointLastThread& event, uint64_t safepoint_id) {
+  const jlong sync_time_ns = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
+  const bool should_log = SafepointSyncReportDelay > 0 &&
+                          sync_time_ns >= SafepointSyncReportDelay * (NANOUNITS / MILLIUNITS);
+  if (!should_log && !event.should_commit()) {
+    return;
+  }
+
+  Method* method = nullptr;
+  int bci = -1;
+  if (thread->has_last_Java_frame() && thread->frame_anchor()->walkable()) {
+    // All threads are stopped, do not process the frames.
+    vframeStream vfst(thread, false /* stop_at_java_call_stub */, false /* process_frames */);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+      bci = vfst.bci();
+    }
+  }
+
+  post_safepoint_last_thread_event(event, safepoint_id, thread, method, bci);
+
+  if (should_log) {
+    ResourceMark rm;
+    log_info(safepoint)("Safepoint synchronization took " JLONG_FORMAT " ms, last thread to arrive: \"%s\" in %s @ %d",
+                        sync_time_ns / (NANOUNITS / MILLIUNITS), thread->name(),
+                        method != nullptr ? method->external_name() : "<no Java frame>", bci);
+  }
+}
+
 static void post_safepoint_cleanup_task_event(EventSafepointCleanupTask& event,
                                               uint64_t safepoint_id,
                                               const char* name) {
@@ -215,7 +263,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** last_to_arrive)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -267,6 +316,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        *last_to_arrive = cur_tss->thread();
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -384,13 +434,15 @@ void SafepointSynchronize::begin() {
   }
 
   EventSafepointStateSynchronization sync_event;
+  EventSafepointLastThread last_thread_event;
   int initial_running = 0;
+  JavaThread* last_to_arrive = nullptr;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_to_arrive);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -437,6 +489,11 @@ void SafepointSynchronize::begin() {
                                    initial_running,
                                    _waiting_to_block, iterations);
 
+  if (last_to_arrive != nullptr) {
+    // Only set when some thread had to be waited for.
+    report_last_to_arrive(last_to_arrive, last_thread_event, _safepoint_id);
+  }
+
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
   // We do the safepoint cleanup first since a GC related safepoint
@@ -514,7 +571,6 @@ void SafepointSynchronize::end() {
 bool SafepointSynchronize::is_cleanup_needed() {
   // Need a safepoint if some inline cache buffers is non-empty
   if (!InlineCacheBuffer::is_empty()) return true;
-  if (StringTable::needs_rehashing()) return true;
   if (SymbolTable::needs_rehashing()) return true;
   return false;
 }
@@ -554,10 +610,6 @@ public:
       workers++;
     }
 
-    if (StringTable::rehash_table_expects_safepoint_rehashing()) {
-      workers++;
-    }
-
     if (InlineCacheBuffer::needs_update_inline_caches()) {
       workers++;
     }
@@ -578,13 +630,6 @@ public:
       }
     }
 
-    if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_STRING_TABLE_REHASH)) {
-      if (StringTable::needs_rehashing()) {
-        Tracer t("rehashing string table");
-        StringTable::rehash_table();
-      }
-    }
-
     if (_subtasks.try_claim_task(SafepointSynchronize::SAFEPOINT_CLEANUP_LAZY_ROOT_PROCESSING)) {
       if (_do_lazy_roots) {
         Tracer t("lazy partial thread root processing");
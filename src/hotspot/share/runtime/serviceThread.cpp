@@ -32,6 +32,7 @@
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -41,7 +42,7 @@
 #include "runtime/jniHandles.hpp"
 #include "runtime/serviceThread.hpp"
 #include "runtime/mutexLocker.hpp"
-#include "runtime/os.hpp"
+#include "runtime/os.inline.hpp"
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "prims/resolvedMethodTable.hpp"
@@ -78,6 +79,42 @@ static void cleanup_oopstorages() {
   }
 }
 
+// Native heap trimming after GC, see TrimNativeHeapAfterGCInterval.
+// Both variables are protected by Service_lock.
+static bool native_heap_trim_requested = false;
+static jlong native_heap_trim_permit_time = 0;
+
+void ServiceThread::request_native_heap_trim() {
+  if (TrimNativeHeapAfterGCInterval == 0 || !os::can_trim_native_heap()) {
+    return;
+  }
+  MonitorLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+  if (!native_heap_trim_requested &&
+      (os::javaTimeNanos() > native_heap_trim_permit_time)) {
+    native_heap_trim_requested = true;
+    ml.notify_all();
+  }
+}
+
+static bool has_native_heap_trim_work_and_reset() {
+  assert_lock_strong(Service_lock);
+  if (!native_heap_trim_requested) {
+    return false;
+  }
+  native_heap_trim_requested = false;
+  native_heap_trim_permit_time =
+    os::javaTimeNanos() + (jlong)TrimNativeHeapAfterGCInterval * NANOSECS_PER_MILLISEC;
+  return true;
+}
+
+static void trim_native_heap() {
+  os::size_change_t sc;
+  if (os::trim_native_heap(&sc) && sc.after != SIZE_MAX) {
+    log_info(os)("Trim native heap after GC: RSS+Swap: " PROPERFMT "->" PROPERFMT,
+                 PROPERFMTARGS(sc.before), PROPERFMTARGS(sc.after));
+  }
+}
+
 void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
   while (true) {
     bool sensors_changed = false;
@@ -95,6 +132,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool oop_handles_to_release = false;
     bool cldg_cleanup_work = false;
     bool jvmti_tagmap_work = false;
+    bool native_heap_trim_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
       // will be handled by safepoint correctly when this thread is
@@ -124,7 +162,8 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
               (oop_handles_to_release = JavaThread::has_oop_handles_to_release()) |
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
-              (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset())
+              (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset()) |
+              (native_heap_trim_work = has_native_heap_trim_work_and_reset())
              ) == 0) {
         // Wait until notified that there is some work to do.
         ml.wait();
@@ -195,6 +234,13 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     if (jvmti_tagmap_work) {
       JvmtiTagMap::flush_all_object_free_events();
     }
+
+    if (native_heap_trim_work) {
+      // malloc_trim can take a long time on large heaps and touches no
+      // oops or VM locks, so run it blocked to not hold up safepoints.
+      ThreadBlockInVM tbivm(jt);
+      trim_native_heap();
+    }
   }
 }
 
@@ -53,6 +53,9 @@ class ServiceThread : public JavaThread {
   // Add event to the service thread event queue.
   static void enqueue_deferred_event(JvmtiDeferredEvent* event);
 
+  // Ask for the C-heap to be trimmed, if TrimNativeHeapAfterGCInterval allows.
+  static void request_native_heap_trim();
+
   // GC support
   void oops_do_no_frames(OopClosure* f, CodeBlobClosure* cf);
   void nmethods_do(CodeBlobClosure* cf);
@@ -367,7 +367,9 @@ class ScanHazardPtrPrintMatchingThreadsClosure : public ThreadClosure {
   }
 };
 
-// Closure to validate hazard ptrs.
+#ifdef ASSERT
+// Closure to validate hazard ptrs. Debug only since it just asserts and
+// would otherwise add another walk over all threads to each free_list().
 //
 class ValidateHazardPtrsClosure : public ThreadClosure {
  public:
@@ -387,6 +389,7 @@ class ValidateHazardPtrsClosure : public ThreadClosure {
            p2i(thread));
   }
 };
+#endif // ASSERT
 
 // Closure to determine if the specified JavaThread is found by
 // threads_do().
@@ -951,8 +954,10 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed.", os::current_thread_id(), p2i(threads));
   }
 
+#ifdef ASSERT
   ValidateHazardPtrsClosure validate_cl;
   threads_do(&validate_cl);
+#endif
 
   delete scan_table;
 }
@@ -24,6 +24,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/archivedClassPreloader.hpp"
 #include "cds/cds_globals.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoader.hpp"
@@ -325,6 +326,8 @@ static void call_initPhase2(TRAPS) {
 //     and system class loader may be a custom class loaded from -Xbootclasspath/a,
 //     other modules or the application's classpath.
 static void call_initPhase3(TRAPS) {
+  TraceTime timer("Initialize system class loader", TRACETIME_LOG(Info, startuptime));
+
   Klass* klass = vmClasses::System_klass();
   JavaValue result(T_VOID);
   JavaCalls::call_static(&result, klass, vmSymbols::initPhase3_name(),
@@ -752,6 +755,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     java_lang_Throwable::print(PENDING_EXCEPTION, tty);
     vm_exit_during_initialization("ClassLoader::initialize_module_path() failed unexpectedly");
   }
+
+  if (ArchivedClassPreloadThreads > 0) {
+    ArchivedClassPreloadThread::initialize();
+  }
 #endif
 
 #if INCLUDE_JVMCI
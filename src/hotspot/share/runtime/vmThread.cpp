@@ -106,6 +106,7 @@ VMThread*         VMThread::_vm_thread          = nullptr;
 VM_Operation*     VMThread::_cur_vm_operation   = nullptr;
 VM_Operation*     VMThread::_next_vm_operation  = &cleanup_op; // Prevent any thread from setting an operation until VM thread is ready.
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = nullptr;
+PerfHistogram*    VMThread::_perf_vm_operation_time_histogram = nullptr;
 VMOperationTimeoutTask* VMThread::_timeout_task = nullptr;
 
 
@@ -136,6 +137,8 @@ void VMThread::create() {
     _perf_accumulated_vm_operation_time =
                  PerfDataManager::create_counter(SUN_THREADS, "vmOperationTime",
                                                  PerfData::U_Ticks, CHECK);
+    _perf_vm_operation_time_histogram =
+                 PerfHistogram::create(SUN_THREADS, "vmOperationTime.histogram", CHECK);
   }
 }
 
@@ -271,6 +274,7 @@ static void post_vm_operation_event(EventExecuteVMOperation* event, VM_Operation
 void VMThread::evaluate_operation(VM_Operation* op) {
   ResourceMark rm;
 
+  jlong start = UsePerfData ? os::elapsed_counter() : 0;
   {
     PerfTraceTime vm_op_timer(perf_accumulated_vm_operation_time());
     HOTSPOT_VMOPS_BEGIN(
@@ -287,7 +291,9 @@ void VMThread::evaluate_operation(VM_Operation* op) {
                      (char *) op->name(), strlen(op->name()),
                      op->evaluate_at_safepoint() ? 0 : 1);
   }
-
+  if (UsePerfData) {
+    _perf_vm_operation_time_histogram->record(os::elapsed_counter() - start);
+  }
 }
 
 class HandshakeALotClosure : public HandshakeClosure {
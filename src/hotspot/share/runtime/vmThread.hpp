@@ -67,6 +67,7 @@ class VMThread: public NamedThread {
   static bool _terminated;
   static Monitor * _terminate_lock;
   static PerfCounter* _perf_accumulated_vm_operation_time;
+  static PerfHistogram* _perf_vm_operation_time_histogram;
 
   static VMOperationTimeoutTask* _timeout_task;
 
@@ -705,6 +705,9 @@ class ParDumpWriter : public AbstractDumpWriter {
   ParWriterBufferQueue* _buffer_queue;
   size_t _internal_buffer_used;
   char* _buffer_base;
+  // A flushed buffer kept for reuse, saving a malloc/free of
+  // io_buffer_max_size bytes and the page faults on the new memory.
+  char* _spare_buffer;
   bool _split_data;
   static const uint BackendFlushThreshold = 2;
  protected:
@@ -731,6 +734,7 @@ class ParDumpWriter : public AbstractDumpWriter {
     _backend_ptr(dw->backend_ptr()),
     _buffer_queue((new (std::nothrow) ParWriterBufferQueue())),
     _buffer_base(nullptr),
+    _spare_buffer(nullptr),
     _split_data(false) {
     // prepare internal buffer
     allocate_internal_buffer();
@@ -744,6 +748,10 @@ class ParDumpWriter : public AbstractDumpWriter {
        os::free(_buffer_base);
        _buffer_base = nullptr;
      }
+     if (_spare_buffer != nullptr) {
+       os::free(_spare_buffer);
+       _spare_buffer = nullptr;
+     }
      delete _buffer_queue;
      _buffer_queue = nullptr;
   }
@@ -791,7 +799,12 @@ class ParDumpWriter : public AbstractDumpWriter {
   void allocate_internal_buffer() {
     assert(_buffer_queue != nullptr, "Internal buffer queue is not ready when allocate internal buffer");
     assert(_buffer == nullptr && _buffer_base == nullptr, "current buffer must be null before allocate");
-    _buffer_base = _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+    if (_spare_buffer != nullptr) {
+      _buffer_base = _buffer = _spare_buffer;
+      _spare_buffer = nullptr;
+    } else {
+      _buffer_base = _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+    }
     if (_buffer == nullptr) {
       set_error("Could not allocate buffer for writer");
       return;
@@ -841,7 +854,11 @@ class ParDumpWriter : public AbstractDumpWriter {
 
   void reclaim_entry(ParWriterBufferQueueElem* entry) {
     assert(entry != nullptr && entry->_buffer != nullptr, "Invalid entry to reclaim");
-    os::free(entry->_buffer);
+    if (_spare_buffer == nullptr) {
+      _spare_buffer = entry->_buffer;
+    } else {
+      os::free(entry->_buffer);
+    }
     entry->_buffer = nullptr;
     os::free(entry);
   }
@@ -871,12 +888,11 @@ class ParDumpWriter : public AbstractDumpWriter {
     // Flush internal buffer.
     if (_internal_buffer_used > 0) {
       flush_buffer(_buffer_base, _internal_buffer_used);
-      os::free(_buffer_base);
+      // The data has been copied to the backend, so keep using the internal buffer.
+      _buffer = _buffer_base;
       _pos = 0;
       _internal_buffer_used = 0;
-      _buffer_base = _buffer = nullptr;
-      // Allocate internal buffer for future use.
-      allocate_internal_buffer();
+      _size = io_buffer_max_size;
     }
   }
 };
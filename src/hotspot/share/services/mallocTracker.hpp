@@ -145,13 +145,15 @@ class MallocMemorySummary;
 
 // A snapshot of malloc'd memory, includes malloc memory
 // usage by types and memory used by tracking itself.
+// There is no separate counter for all mallocs. Totals are summed up over
+// the types when asked for, so that every malloc and free only updates the
+// counter of its own type instead of also a single counter shared by all
+// threads.
 class MallocMemorySnapshot : public ResourceObj {
   friend class MallocMemorySummary;
 
  private:
   MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _all_mallocs;
-
 
  public:
   inline MallocMemory* by_type(MEMFLAGS flags) {
@@ -165,18 +167,14 @@ class MallocMemorySnapshot : public ResourceObj {
   }
 
   inline size_t malloc_overhead() const {
-    return _all_mallocs.count() * sizeof(MallocHeader);
+    return total_count() * sizeof(MallocHeader);
   }
 
   // Total malloc invocation count
-  size_t total_count() const {
-    return _all_mallocs.count();
-  }
+  size_t total_count() const;
 
   // Total malloc'd memory amount
-  size_t total() const {
-    return _all_mallocs.size() + malloc_overhead() + total_arena();
-  }
+  size_t total() const;
 
   // Total malloc'd memory used by arenas
   size_t total_arena() const;
@@ -191,7 +189,6 @@ class MallocMemorySnapshot : public ResourceObj {
     // copy is going on, because their size is adjusted using this
     // buffer in make_adjustment().
     ThreadCritical tc;
-    s->_all_mallocs = _all_mallocs;
     for (int index = 0; index < mt_number_of_types; index ++) {
       s->_malloc[index] = _malloc[index];
     }
@@ -224,12 +221,10 @@ class MallocMemorySummary : AllStatic {
 
    static inline void record_malloc(size_t size, MEMFLAGS flag) {
      as_snapshot()->by_type(flag)->record_malloc(size);
-     as_snapshot()->_all_mallocs.allocate(size);
    }
 
    static inline void record_free(size_t size, MEMFLAGS flag) {
      as_snapshot()->by_type(flag)->record_free(size);
-     as_snapshot()->_all_mallocs.deallocate(size);
    }
 
    static inline void record_new_arena(MEMFLAGS flag) {
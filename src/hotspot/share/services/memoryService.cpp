@@ -34,6 +34,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/serviceThread.hpp"
 #include "services/classLoadingService.hpp"
 #include "services/lowMemoryDetector.hpp"
 #include "services/management.hpp"
@@ -187,6 +188,7 @@ void MemoryService::gc_end(GCMemoryManager* manager, bool recordPostGCUsage,
   // register the GC end statistics and memory usage
   manager->gc_end(recordPostGCUsage, recordAccumulatedGCTime, recordGCEndTime,
                   countCollection, cause, allMemoryPoolsAffected, message);
+  ServiceThread::request_native_heap_trim();
 }
 
 bool MemoryService::set_verbose(bool verbose) {
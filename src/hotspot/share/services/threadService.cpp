@@ -42,6 +42,7 @@
 #include "prims/jvmtiRawMonitor.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/init.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/objectMonitor.inline.hpp"
@@ -318,6 +319,54 @@ void ThreadService::remove_thread_dump(ThreadDumpResult* dump) {
   assert(found, "The threaddump result to be removed must exist.");
 }
 
+// Takes the snapshot of a single thread in a handshake with that thread.
+// Only used for dumps without lock information, which need a consistent
+// view of all threads and therefore a safepoint.
+class ThreadSnapshotClosure : public HandshakeClosure {
+  ThreadDumpResult* _result;
+  bool              _done;
+ public:
+  ThreadSnapshotClosure(ThreadDumpResult* result) :
+    HandshakeClosure("ThreadSnapshot"), _result(result), _done(false) {}
+
+  void do_thread(Thread* th) {
+    JavaThread* jt = JavaThread::cast(th);
+    ResourceMark rm;
+    HandleMark hm(Thread::current());
+    ThreadSnapshot* snapshot = _result->add_thread_snapshot(jt);
+    snapshot->dump_stack_at_safepoint(-1, false, nullptr, false);
+    _done = true;
+  }
+
+  bool done() const { return _done; }
+};
+
+// Snapshot the given threads one handshake at a time instead of stopping
+// all threads at a safepoint. Handshakes are executed in order, so the
+// snapshots are still linked in the order of the threads array.
+static void dump_threads_with_handshakes(ThreadDumpResult* dump_result,
+                                         GrowableArray<instanceHandle>* threads,
+                                         int num_threads) {
+  dump_result->set_t_list();
+  for (int i = 0; i < num_threads; i++) {
+    instanceHandle th = threads->at(i);
+    JavaThread* jt = th() != nullptr ? java_lang_Thread::thread(th()) : nullptr;
+    if (jt != nullptr && !dump_result->t_list()->includes(jt)) {
+      // See VM_ThreadDump::doit().
+      jt = nullptr;
+    }
+    if (jt != nullptr && !jt->is_exiting() && !jt->is_hidden_from_external_view()) {
+      ThreadSnapshotClosure cl(dump_result);
+      Handshake::execute(&cl, jt);
+      if (cl.done()) {
+        continue;
+      }
+    }
+    // Add a dummy snapshot for threads that are gone or skipped.
+    dump_result->add_thread_snapshot();
+  }
+}
+
 // Dump stack trace of threads specified in the given threads array.
 // Returns StackTraceElement[][] each element is the stack trace of a thread in
 // the corresponding entry in the given threads array
@@ -327,13 +376,17 @@ Handle ThreadService::dump_stack_traces(GrowableArray<instanceHandle>* threads,
   assert(num_threads > 0, "just checking");
 
   ThreadDumpResult dump_result;
-  VM_ThreadDump op(&dump_result,
-                   threads,
-                   num_threads,
-                   -1,    /* entire stack */
-                   false, /* with locked monitors */
-                   false  /* with locked synchronizers */);
-  VMThread::execute(&op);
+  if (ThreadDumpUsingHandshakes) {
+    dump_threads_with_handshakes(&dump_result, threads, num_threads);
+  } else {
+    VM_ThreadDump op(&dump_result,
+                     threads,
+                     num_threads,
+                     -1,    /* entire stack */
+                     false, /* with locked monitors */
+                     false  /* with locked synchronizers */);
+    VMThread::execute(&op);
+  }
 
   // Allocate the resulting StackTraceElement[][] object
 
@@ -688,7 +741,9 @@ ThreadStackTrace::~ThreadStackTrace() {
 }
 
 void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth, ObjectMonitorsHashtable* table, bool full) {
-  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  assert(SafepointSynchronize::is_at_safepoint() ||
+         (!_with_locked_monitors && _thread->is_handshake_safe_for(Thread::current())),
+         "all threads are stopped or the target is in a handshake");
 
   if (_thread->has_last_Java_frame()) {
     RegisterMap reg_map(_thread,
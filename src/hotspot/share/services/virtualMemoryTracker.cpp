@@ -50,6 +50,7 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
 }
 
 SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
+ReservedMemoryRegion* VirtualMemoryTracker::_last_reserved_region = nullptr;
 
 int compare_committed_region(const CommittedMemoryRegion& r1, const CommittedMemoryRegion& r2) {
   return r1.compare(r2);
@@ -422,6 +423,21 @@ void VirtualMemoryTracker::set_reserved_region_type(address addr, MEMFLAGS flag)
   }
 }
 
+// Commits and uncommits tend to come in runs against the same reservation,
+// e.g. while a GC expands or shrinks its heap region by region. Checking the
+// previous result first avoids searching the list of all reserved regions,
+// which also holds every thread stack.
+ReservedMemoryRegion* VirtualMemoryTracker::find_reserved_region(address addr, size_t size) {
+  ReservedMemoryRegion* last = _last_reserved_region;
+  if (last != nullptr && last->contain_region(addr, size)) {
+    return last;
+  }
+  ReservedMemoryRegion  rgn(addr, size);
+  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  _last_reserved_region = reserved_rgn;
+  return reserved_rgn;
+}
+
 bool VirtualMemoryTracker::add_committed_region(address addr, size_t size,
   const NativeCallStack& stack) {
   assert(addr != nullptr, "Invalid address");
@@ -429,7 +445,7 @@ bool VirtualMemoryTracker::add_committed_region(address addr, size_t size,
   assert(_reserved_regions != nullptr, "Sanity check");
 
   ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(addr, size);
 
   if (reserved_rgn == nullptr) {
     log_debug(nmt)("Add committed region \'%s\', No reserved region found for  (" INTPTR_FORMAT ", " SIZE_FORMAT ")",
@@ -448,8 +464,7 @@ bool VirtualMemoryTracker::remove_uncommitted_region(address addr, size_t size)
   assert(size > 0, "Invalid size");
   assert(_reserved_regions != nullptr, "Sanity check");
 
-  ReservedMemoryRegion  rgn(addr, size);
-  ReservedMemoryRegion* reserved_rgn = _reserved_regions->find(rgn);
+  ReservedMemoryRegion* reserved_rgn = find_reserved_region(addr, size);
   assert(reserved_rgn != nullptr, "No reserved region (" INTPTR_FORMAT ", " SIZE_FORMAT ")", p2i(addr), size);
   assert(reserved_rgn->contain_region(addr, size), "Not completely contained");
   const char* flag_name = reserved_rgn->flag_name();  // after remove, info is not complete
@@ -473,6 +488,7 @@ bool VirtualMemoryTracker::remove_released_region(ReservedMemoryRegion* rgn) {
   }
 
   VirtualMemorySummary::record_released_memory(rgn->size(), rgn->flag());
+  _last_reserved_region = nullptr;
   result =  _reserved_regions->remove(*rgn);
   log_debug(nmt)("Removed region \'%s\' (" INTPTR_FORMAT ", " SIZE_FORMAT ") from _resvered_regions %s" ,
                 backup.flag_name(), p2i(backup.base()), backup.size(), (result ? "Succeeded" : "Failed"));
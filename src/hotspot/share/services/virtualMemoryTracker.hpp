@@ -398,7 +398,12 @@ class VirtualMemoryTracker : AllStatic {
   static void snapshot_thread_stacks();
 
  private:
+  // Find the reserved region containing [addr, addr + size), checking the
+  // region found by the previous lookup first.
+  static ReservedMemoryRegion* find_reserved_region(address addr, size_t size);
+
   static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+  static ReservedMemoryRegion* _last_reserved_region;
 };
 
 #endif // SHARE_SERVICES_VIRTUALMEMORYTRACKER_HPP
@@ -259,6 +259,10 @@ class ConcurrentHashTable : public CHeapObj<F> {
   // can only be used by the owner of _resize_lock.
   volatile Thread* _invisible_epoch;
 
+  // Set when a MoveTask is prepared. Inserts into a closed table fail, so all
+  // items end up in the table they are moved to.
+  volatile bool _closed;
+
   // Scoped critical section, which also handles the invisible epochs.
   // An invisible epoch/version do not need a write_synchronize().
   class ScopedCS: public StackObj {
@@ -392,6 +396,12 @@ class ConcurrentHashTable : public CHeapObj<F> {
                                  size_t stop_idx, EVALUATE_FUNC& eval_f,
                                  DELETE_FUNC& del_f, bool is_mt = false);
 
+  // Calls MOVE_FUNC on each item in this range of buckets and then unlinks and
+  // destroys them. Caller must have locked _resize_lock and closed the table.
+  template <typename MOVE_FUNC>
+  void do_bulk_move_locked_for(Thread* thread, size_t start_idx,
+                               size_t stop_idx, MOVE_FUNC& move_f);
+
   // Method to delete one items.
   template <typename LOOKUP_FUNC>
   void delete_in_bucket(Thread* thread, Bucket* bucket, LOOKUP_FUNC& lookup_f);
@@ -443,7 +453,7 @@ class ConcurrentHashTable : public CHeapObj<F> {
            bool* grow_hint = nullptr);
 
   // Returns true true if the item was inserted, duplicates are found with
-  // LOOKUP_FUNC.
+  // LOOKUP_FUNC. Always returns false once the table is closed by a MoveTask.
   template <typename LOOKUP_FUNC>
   bool insert(Thread* thread, LOOKUP_FUNC& lookup_f, const VALUE& value,
               bool* grow_hint = nullptr, bool* clean_hint = nullptr) {
@@ -543,6 +553,7 @@ class ConcurrentHashTable : public CHeapObj<F> {
  public:
   class BulkDeleteTask;
   class GrowTask;
+  class MoveTask;
   class ScanTask;
 };
 
@@ -534,6 +534,42 @@ inline void ConcurrentHashTable<CONFIG, F>::
   GlobalCounter::critical_section_end(thread, cs_context);
 }
 
+template <typename CONFIG, MEMFLAGS F>
+template <typename MOVE_FUNC>
+inline void ConcurrentHashTable<CONFIG, F>::
+  do_bulk_move_locked_for(Thread* thread, size_t start_idx, size_t stop_idx,
+                          MOVE_FUNC& move_f)
+{
+  assert(_resize_lock_owner == thread, "Re-size lock not held");
+  assert(Atomic::load(&_closed), "Table must be closed");
+  InternalTable* table = get_table();
+  assert(start_idx < stop_idx, "Must be");
+  assert(stop_idx <= _table->_size, "Must be");
+  for (size_t bucket_it = start_idx; bucket_it < stop_idx; bucket_it++) {
+    Bucket* bucket = table->get_bucket(bucket_it);
+    // The table is closed, so an empty bucket stays empty.
+    if (bucket->first() == nullptr) {
+      continue;
+    }
+    bucket->lock();
+    // MOVE_FUNC makes each item reachable elsewhere before the chain is
+    // unlinked, so concurrent readers find it in at least one place.
+    Node* chain = bucket->first();
+    for (Node* node = chain; node != nullptr; node = node->next()) {
+      move_f(node->value());
+    }
+    bucket->release_assign_node_ptr(bucket->first_ptr(), nullptr);
+    bucket->unlock();
+    write_synchonize_on_visible_epoch(thread);
+    while (chain != nullptr) {
+      Node* next = chain->next();
+      Node::destroy_node(_context, chain);
+      JFR_ONLY(safe_stats_remove();)
+      chain = next;
+    }
+  }
+}
+
 template <typename CONFIG, MEMFLAGS F>
 template <typename LOOKUP_FUNC>
 inline void ConcurrentHashTable<CONFIG, F>::
@@ -900,6 +936,9 @@ inline bool ConcurrentHashTable<CONFIG, F>::
   while (true) {
     {
       ScopedCS cs(thread, this); /* protected the table/bucket */
+      if (Atomic::load_acquire(&_closed)) {
+        break; /* leave critical section */
+      }
       Bucket* bucket = get_bucket(hash);
       Node* first_at_start = bucket->first();
       Node* old = get_node(bucket, lookup_f, &clean, &loops);
@@ -1020,7 +1059,7 @@ ConcurrentHashTable(size_t log2size, size_t log2size_limit, size_t grow_hint, bo
     : _context(context), _new_table(nullptr), _log2_size_limit(log2size_limit),
       _log2_start_size(log2size), _grow_hint(grow_hint),
       _size_limit_reached(false), _resize_lock_owner(nullptr),
-      _invisible_epoch(0)
+      _invisible_epoch(0), _closed(false)
 {
   if (enable_statistics) {
     _stats_rate = new TableRateStatistics();
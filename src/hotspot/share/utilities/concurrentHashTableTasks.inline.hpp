@@ -31,8 +31,8 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 
-// This inline file contains BulkDeleteTask and GrowTasks which are both bucket
-// operations, which they are serialized with each other.
+// This inline file contains BulkDeleteTask, GrowTask and MoveTask which are all
+// bucket operations, which they are serialized with each other.
 
 // Base class for pause and/or parallel bulk operations.
 template <typename CONFIG, MEMFLAGS F>
@@ -229,6 +229,54 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   }
 };
 
+// For doing pausable moves of all items into another table, e.g. one using a
+// different hash function. The table stays readable while items are moved,
+// but once prepared it no longer accepts inserts. Lookups must search both
+// tables until done, after which this table is empty and can be deleted.
+template <typename CONFIG, MEMFLAGS F>
+class ConcurrentHashTable<CONFIG, F>::MoveTask :
+  public BucketsOperation
+{
+ public:
+  MoveTask(ConcurrentHashTable<CONFIG, F>* cht) : BucketsOperation(cht) {
+  }
+  // Before start prepare must be called. When it returns true no insert
+  // into this table is in progress and all later inserts fail.
+  bool prepare(Thread* thread) {
+    bool lock = BucketsOperation::_cht->try_resize_lock(thread);
+    if (!lock) {
+      return false;
+    }
+    Atomic::release_store(&BucketsOperation::_cht->_closed, true);
+    GlobalCounter::write_synchronize();
+    this->setup(thread);
+    return true;
+  }
+
+  // Does one range calling MOVE_FUNC on every item, which must insert it into
+  // the other table, before destroying it. Returns true if there is more work.
+  template <typename MOVE_FUNC>
+  bool do_task(Thread* thread, MOVE_FUNC& move_f) {
+    size_t start, stop;
+    assert(BucketsOperation::_cht->_resize_lock_owner != nullptr,
+           "Should be locked");
+    if (!this->claim(&start, &stop)) {
+      return false;
+    }
+    BucketsOperation::_cht->do_bulk_move_locked_for(thread, start, stop, move_f);
+    assert(BucketsOperation::_cht->_resize_lock_owner != nullptr,
+           "Should be locked");
+    return true;
+  }
+
+  // Must be called after ranges are done.
+  void done(Thread* thread) {
+    this->thread_owns_resize_lock(thread);
+    BucketsOperation::_cht->unlock_resize_lock(thread);
+    this->thread_do_not_own_resize_lock(thread);
+  }
+};
+
 template <typename CONFIG, MEMFLAGS F>
 class ConcurrentHashTable<CONFIG, F>::ScanTask :
   public BucketsOperation
@@ -97,6 +97,19 @@ char* UTF8::next_character(const char* str, jint* value) {
   return next_ch;
 }
 
+// Word-at-a-time helpers for the ASCII fast paths below. Loads go
+// through memcpy so the input does not need to be aligned.
+static const uint64_t bytes_ones  = UCONST64(0x0101010101010101);
+static const uint64_t bytes_highs = UCONST64(0x8080808080808080);
+static const uint64_t chars_ones  = UCONST64(0x0001000100010001);
+static const uint64_t chars_highs = UCONST64(0x8000800080008000);
+
+static inline uint64_t load_word(const void* p) {
+  uint64_t w;
+  memcpy(&w, p, sizeof(w));
+  return w;
+}
+
 // Count bytes of the form 10xxxxxx and deduct this count
 // from the total byte count.  The utf8 string must be in
 // legal form which has been verified in the format checker.
@@ -104,8 +117,13 @@ int UTF8::unicode_length(const char* str, int len, bool& is_latin1, bool& has_mu
   int num_chars = len;
   has_multibyte = false;
   is_latin1 = true;
-  unsigned char prev = 0;
-  for (int i = 0; i < len; i++) {
+  int i = 0;
+  // Skip over leading ASCII, which cannot contain continuation bytes
+  while (i + (int)sizeof(uint64_t) <= len && (load_word(str + i) & bytes_highs) == 0) {
+    i += sizeof(uint64_t);
+  }
+  unsigned char prev = (i > 0) ? str[i - 1] : 0;
+  for (; i < len; i++) {
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -176,6 +194,13 @@ template<typename T> void UTF8::convert_to_unicode(const char* utf8_str, T* unic
   int index = 0;
 
   /* ASCII case loop optimization */
+  for (; index + (int)sizeof(uint64_t) <= unicode_length; index += sizeof(uint64_t)) {
+    if ((load_word(ptr) & bytes_highs) != 0) { break; }
+    for (int i = 0; i < (int)sizeof(uint64_t); i++) {
+      unicode_str[index + i] = (T)(unsigned char)ptr[i];
+    }
+    ptr += sizeof(uint64_t);
+  }
   for (; index < unicode_length; index++) {
     if((ch = ptr[0]) > 0x7F) { break; }
     unicode_str[index] = (T)ch;
@@ -332,7 +357,14 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
                          bool version_leq_47) {
   int i = 0;
-  int count = length >> 2;
+  // Skip over plain ASCII a word at a time. As below, (v | v - 1) has the
+  // high bit set in any byte that is zero or >= 128. A borrow out of a zero
+  // byte may also set it in the next byte, which only stops this loop early.
+  for (; i + (int)sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t w = load_word(buffer + i);
+    if (((w | (w - bytes_ones)) & bytes_highs) != 0) break;
+  }
+  int count = (length - i) >> 2;
   for (int k=0; k<count; k++) {
     unsigned char b0 = buffer[i];
     unsigned char b1 = buffer[i+1];
@@ -406,6 +438,39 @@ bool UNICODE::is_latin1(const jchar* base, int length) {
   return true;
 }
 
+// Returns the number of leading characters that are encoded as a
+// single byte in modified UTF-8, i.e. that are in the range 0x01 - 0x7F.
+static int ascii_prefix_length(const jbyte* base, int length) {
+  int index = 0;
+  for (; index + (int)sizeof(uint64_t) <= length; index += sizeof(uint64_t)) {
+    uint64_t w = load_word(base + index);
+    // Stop at a byte with the high bit set or at a zero byte
+    if ((w & bytes_highs) != 0 || ((w - bytes_ones) & ~w & bytes_highs) != 0) {
+      break;
+    }
+  }
+  while (index < length && base[index] >= 0x01) {
+    index++;
+  }
+  return index;
+}
+
+static int ascii_prefix_length(const jchar* base, int length) {
+  const int chars_per_word = sizeof(uint64_t) / sizeof(jchar);
+  int index = 0;
+  for (; index + chars_per_word <= length; index += chars_per_word) {
+    uint64_t w = load_word(base + index);
+    // Stop at a char above 0x7F or at a zero char
+    if ((w & UCONST64(0xFF80FF80FF80FF80)) != 0 || ((w - chars_ones) & ~w & chars_highs) != 0) {
+      break;
+    }
+  }
+  while (index < length && base[index] >= 0x0001 && base[index] <= 0x007F) {
+    index++;
+  }
+  return index;
+}
+
 int UNICODE::utf8_size(jchar c) {
   if ((0x0001 <= c) && (c <= 0x007F)) {
     // ASCII character
@@ -431,8 +496,8 @@ int UNICODE::utf8_size(jbyte c) {
 
 template<typename T>
 int UNICODE::utf8_length(const T* base, int length) {
-  int result = 0;
-  for (int index = 0; index < length; index++) {
+  int result = ascii_prefix_length(base, length);
+  for (int index = result; index < length; index++) {
     T c = base[index];
     result += utf8_size(c);
   }
@@ -453,7 +518,14 @@ char* UNICODE::as_utf8(const T* base, int& length) {
 char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
   assert(buflen > 0, "zero length output buffer");
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  // Narrow the ASCII prefix directly, leaving room for the terminator
+  int ascii_len = MIN2(ascii_prefix_length(base, length), buflen - 1);
+  for (int index = 0; index < ascii_len; index++) {
+    p[index] = (u_char)base[index];
+  }
+  p += ascii_len;
+  buflen -= ascii_len;
+  for (int index = ascii_len; index < length; index++) {
     jchar c = base[index];
     buflen -= utf8_size(c);
     if (buflen <= 0) break; // string is truncated
@@ -466,7 +538,12 @@ char* UNICODE::as_utf8(const jchar* base, int length, char* buf, int buflen) {
 char* UNICODE::as_utf8(const jbyte* base, int length, char* buf, int buflen) {
   assert(buflen > 0, "zero length output buffer");
   u_char* p = (u_char*)buf;
-  for (int index = 0; index < length; index++) {
+  // Copy the ASCII prefix in bulk, leaving room for the terminator
+  int ascii_len = MIN2(ascii_prefix_length(base, length), buflen - 1);
+  memcpy(p, base, ascii_len);
+  p += ascii_len;
+  buflen -= ascii_len;
+  for (int index = ascii_len; index < length; index++) {
     jbyte c = base[index];
     int sz = utf8_size(c);
     buflen -= sz;
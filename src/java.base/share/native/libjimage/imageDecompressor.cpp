@@ -157,8 +157,16 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
         compressed_resource += 1;
         has_header = _header._magic == ResourceHeader::resource_header_magic;
         if (has_header) {
-            // decompressed_resource array contains the result of decompression
-            decompressed_resource = new u1[(size_t) _header._uncompressed_size];
+            // decompressed_resource array contains the result of decompression.
+            // A result of the final size (normally from the last decompressor
+            // of the stack) is written straight into the caller's buffer,
+            // unless that buffer is the input of this step.
+            if (_header._uncompressed_size == uncompressed_size &&
+                compressed_resource_base != uncompressed) {
+                decompressed_resource = uncompressed;
+            } else {
+                decompressed_resource = new u1[(size_t) _header._uncompressed_size];
+            }
             // Retrieve the decompressor name
             const char* decompressor_name = strings->get(_header._decompressor_name_offset);
             assert(decompressor_name && "image decompressor not found");
@@ -168,14 +176,17 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
             // Ask the decompressor to decompress the compressed content
             decompressor->decompress_resource(compressed_resource, decompressed_resource,
                 &_header, strings);
-            if (compressed_resource_base != compressed) {
+            if (compressed_resource_base != compressed &&
+                compressed_resource_base != uncompressed) {
                 delete[] compressed_resource_base;
             }
             compressed_resource = decompressed_resource;
         }
     } while (has_header);
-    memcpy(uncompressed, decompressed_resource, (size_t) uncompressed_size);
-    delete[] decompressed_resource;
+    if (decompressed_resource != uncompressed) {
+        memcpy(uncompressed, decompressed_resource, (size_t) uncompressed_size);
+        delete[] decompressed_resource;
+    }
 }
 
 // Zip decompressor
@@ -31,6 +31,9 @@
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #include "childproc.h"
 
@@ -77,6 +80,14 @@ closeDescriptors(void)
     struct dirent *dirp;
     int from_fd = FAIL_FILENO + 1;
 
+#if defined(__linux__) && defined(SYS_close_range)
+    /* Linux 5.9 and later can close the whole range in a single system
+     * call, without scanning /proc/self/fd. Older kernels fail with
+     * ENOSYS, in which case we fall back to the scan below. */
+    if (syscall(SYS_close_range, from_fd, ~0U, 0) == 0)
+        return 1;
+#endif
+
     /* We're trying to close all file descriptors, but opendir() might
      * itself be implemented using a file descriptor, and we certainly
      * don't want to close that while it's in use.  We assume that if
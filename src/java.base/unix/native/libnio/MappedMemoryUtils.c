@@ -44,6 +44,11 @@ typedef unsigned char mincore_vec_t;
 typedef char mincore_vec_t;
 #endif
 
+/* Populate page tables for a readable range, available since Linux 5.14 */
+#if defined(__linux__) && !defined(MADV_POPULATE_READ)
+#define MADV_POPULATE_READ 22
+#endif
+
 #ifdef _AIX
 static long calculate_number_of_pages_in_range(void* address, size_t len, size_t pagesize) {
     uintptr_t address_unaligned = (uintptr_t) address;
@@ -108,7 +113,19 @@ Java_java_nio_MappedMemoryUtils_load0(JNIEnv *env, jobject obj, jlong address,
                                      jlong len)
 {
     char *a = (char *)jlong_to_ptr(address);
-    int result = madvise((caddr_t)a, (size_t)len, MADV_WILLNEED);
+    int result;
+#ifdef __linux__
+    /* Fault the whole range in with a single call, so that touching the
+     * pages afterwards does not take a page fault for every page. Older
+     * kernels reject the advice with EINVAL, and a range that extends
+     * beyond the end of the file fails with EFAULT; in both cases fall
+     * back to the asynchronous read-ahead hint. */
+    result = madvise((caddr_t)a, (size_t)len, MADV_POPULATE_READ);
+    if (result == 0) {
+        return;
+    }
+#endif
+    result = madvise((caddr_t)a, (size_t)len, MADV_WILLNEED);
     if (result == -1) {
         JNU_ThrowIOExceptionWithMessageAndLastError(env, "madvise with advise MADV_WILLNEED failed");
     }
@@ -49,7 +49,11 @@
 
 // The default time for a period in microseconds.
 // For very small buffers, only 2 periods are used.
+// Otherwise, a buffer is divided into at least MIN_PERIOD_COUNT periods,
+// so that small buffers requested for low latency are refilled in
+// correspondingly small chunks.
 #define DEFAULT_PERIOD_TIME 20000 /* 20ms */
+#define MIN_PERIOD_COUNT 4
 
 ///// implemented functions of DirectAudio.h
 
@@ -356,11 +360,15 @@ int setHWParams(AlsaPcmInfo* info,
     bufferSizeInFrames = (int) alsaBufferSizeInFrames;
     /* set the period time */
     if (bufferSizeInFrames > 1024) {
+        unsigned int bufferTime = (unsigned int) (((double) bufferSizeInFrames * 1000000.0) / rrate);
         dir = 0;
         periodTime = DEFAULT_PERIOD_TIME;
+        if (periodTime > bufferTime / MIN_PERIOD_COUNT) {
+            periodTime = bufferTime / MIN_PERIOD_COUNT;
+        }
         ret = snd_pcm_hw_params_set_period_time_near(info->handle, info->hwParams, &periodTime, &dir);
         if (ret < 0) {
-            ERROR2("Unable to set period time to %d: %s\n", DEFAULT_PERIOD_TIME, snd_strerror(ret));
+            ERROR2("Unable to set period time to %d: %s\n", (int) periodTime, snd_strerror(ret));
             return FALSE;
         }
     } else {
@@ -237,7 +237,7 @@
                              cur.texture, cur.texture.width, cur.texture.height,
                              time(NULL) - cur.lastUsed);
 #endif //DEBUG
-                deallocMem += cur.texture.width * cur.texture.height * 4;
+                deallocMem += cur.texture.width * cur.texture.height * 4 * cur.texture.sampleCount;
                 [self removeAvailableItem:cur];
             } else {
                 if (lastUsedTimeToRemove > 0) break;
@@ -299,7 +299,7 @@
 @end
 
 @implementation MTLTexturePool {
-    int _memoryTotalAllocated;
+    NSUInteger _memoryTotalAllocated;
 
     void ** _cells;
     int _poolCellWidth;
@@ -354,7 +354,9 @@
                           isMultiSample:(bool)isMultiSample {
         // 1. clean pool if necessary
         const int requestedPixels = width*height;
-        const int requestedBytes = requestedPixels*4;
+        // multisample textures store MTLAASampleCount samples per pixel
+        const NSUInteger requestedBytes = (NSUInteger)requestedPixels * 4 *
+                                          (isMultiSample ? MTLAASampleCount : 1);
         if (_memoryTotalAllocated + requestedBytes > _maxPoolMemory) {
             [self cleanIfNecessary:0]; // release all free textures
         } else if (_memoryTotalAllocated + requestedBytes > _maxPoolMemory/2) {
@@ -425,7 +427,7 @@
             }
             minDeltaTpi = [cell createItem:device width:width height:height format:format isMultiSample:isMultiSample];
             _memoryTotalAllocated += requestedBytes;
-            J2dTraceLn5(J2D_TRACE_VERBOSE, "MTLTexturePool: created pool item: tex=%p, w=%d h=%d, pf=%d | total memory = %d Kb", minDeltaTpi.texture, width, height, format, _memoryTotalAllocated/1024);
+            J2dTraceLn5(J2D_TRACE_VERBOSE, "MTLTexturePool: created pool item: tex=%p, w=%d h=%d, pf=%d | total memory = %d Kb", minDeltaTpi.texture, width, height, format, (int)(_memoryTotalAllocated/1024));
         }
 
         minDeltaTpi.isBusy = YES;
@@ -218,6 +218,10 @@ JDKFontInfo*
     } else {
         fi->devScale = 1.0f;
     }
+    for (int i = 0; i < JDK_HB_CACHE_SIZE; i++) {
+        fi->cachedChars[i] = JDK_HB_CACHE_EMPTY;
+        fi->cachedAdvanceGlyphs[i] = JDK_HB_CACHE_EMPTY;
+    }
     return fi;
 }
 
@@ -46,6 +46,11 @@ hb_jdk_get_nominal_glyph (hb_font_t *font HB_UNUSED,
 {
 
     JDKFontInfo *jdkFontInfo = (JDKFontInfo*)font_data;
+    unsigned int slot = unicode & (JDK_HB_CACHE_SIZE - 1);
+    if (jdkFontInfo->cachedChars[slot] == unicode) {
+        *glyph = jdkFontInfo->cachedCharGlyphs[slot];
+        return (*glyph != 0);
+    }
     JNIEnv* env = jdkFontInfo->env;
     jobject font2D = jdkFontInfo->font2D;
     *glyph = (hb_codepoint_t)env->CallIntMethod(
@@ -57,6 +62,8 @@ hb_jdk_get_nominal_glyph (hb_font_t *font HB_UNUSED,
     if ((int)*glyph < 0) {
         *glyph = 0;
     }
+    jdkFontInfo->cachedChars[slot] = unicode;
+    jdkFontInfo->cachedCharGlyphs[slot] = *glyph;
     return (*glyph != 0);
 }
 
@@ -98,6 +105,10 @@ hb_jdk_get_glyph_h_advance (hb_font_t *font HB_UNUSED,
     }
 
     JDKFontInfo *jdkFontInfo = (JDKFontInfo*)font_data;
+    unsigned int slot = glyph & (JDK_HB_CACHE_SIZE - 1);
+    if (jdkFontInfo->cachedAdvanceGlyphs[slot] == glyph) {
+        return jdkFontInfo->cachedAdvances[slot];
+    }
     JNIEnv* env = jdkFontInfo->env;
     jobject fontStrike = jdkFontInfo->fontStrike;
     jobject pt = env->CallObjectMethod(fontStrike,
@@ -110,7 +121,10 @@ hb_jdk_get_glyph_h_advance (hb_font_t *font HB_UNUSED,
     fadv *= jdkFontInfo->devScale;
     env->DeleteLocalRef(pt);
 
-    return HBFloatToFixed(fadv);
+    hb_position_t adv = HBFloatToFixed(fadv);
+    jdkFontInfo->cachedAdvanceGlyphs[slot] = glyph;
+    jdkFontInfo->cachedAdvances[slot] = adv;
+    return adv;
 }
 
 static hb_position_t
@@ -34,6 +34,13 @@
 extern "C" {
 #endif
 
+/*
+ * Size of the direct-mapped caches of glyph codes and horizontal advances
+ * kept in JDKFontInfo. Must be a power of 2.
+ */
+#define JDK_HB_CACHE_SIZE 64
+#define JDK_HB_CACHE_EMPTY ((hb_codepoint_t)-1)
+
 typedef struct JDKFontInfo_Struct {
     JNIEnv* env;
     jobject font2D;
@@ -43,6 +50,15 @@ typedef struct JDKFontInfo_Struct {
     float xPtSize;
     float yPtSize;
     float devScale; // How much applying the full glyph tx scales x distance.
+    /*
+     * A JDKFontInfo lives for a single shaping call, so these caches only
+     * save repeated up-calls into Java for characters and glyphs occurring
+     * more than once in the run being shaped.
+     */
+    hb_codepoint_t cachedChars[JDK_HB_CACHE_SIZE];
+    hb_codepoint_t cachedCharGlyphs[JDK_HB_CACHE_SIZE];
+    hb_codepoint_t cachedAdvanceGlyphs[JDK_HB_CACHE_SIZE];
+    hb_position_t cachedAdvances[JDK_HB_CACHE_SIZE];
 } JDKFontInfo;
 
 
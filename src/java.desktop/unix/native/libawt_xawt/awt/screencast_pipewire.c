@@ -33,6 +33,7 @@
 #include "screencast_pipewire.h"
 #include "fp_pipewire.h"
 #include <stdio.h>
+#include <string.h>
 
 #include "gtk_interface.h"
 #include "gtk3_interface.h"
@@ -171,7 +172,8 @@ static gchar * cropTo(
 
     int* d = data.data;
 
-    int *outData = calloc(width * height, sizeof(int));
+    // every pixel is written below, no need to clear the buffer
+    int *outData = malloc(width * height * sizeof(int));
     if (!outData) {
         ERR("failed to allocate memory\n");
         return NULL;
@@ -179,12 +181,16 @@ static gchar * cropTo(
 
     gboolean needConversion = raw.format != SPA_VIDEO_FORMAT_BGRx;
     for (guint32 j = y; j < y + height; ++j) {
-        for (guint32 i = x; i < x + width; ++i) {
-            int color = *(d + (j * srcW) + i);
-            if (needConversion) {
-                convertRGBxToBGRx(&color);
-            }
-            *(outData + ((j - y) * width) + (i - x)) = color;
+        int *srcRow = d + (j * srcW) + x;
+        int *dstRow = outData + ((j - y) * width);
+        if (!needConversion) {
+            memcpy(dstRow, srcRow, width * sizeof(int));
+            continue;
+        }
+        for (guint32 i = 0; i < width; ++i) {
+            int color = srcRow[i];
+            convertRGBxToBGRx(&color);
+            dstRow[i] = color;
         }
     }
 
@@ -269,6 +275,8 @@ static void onStreamProcess(void *userdata) {
         || spaBuffer->datas[0].data == NULL) {
         DEBUG_SCREEN_PREFIX(screen, "!!! no data, n_datas %d\n",
                             spaBuffer->n_datas);
+        // give the buffer back, otherwise the stream runs out of buffers
+        fp_pw_stream_queue_buffer(data->stream, pwBuffer);
         return;
     }
 
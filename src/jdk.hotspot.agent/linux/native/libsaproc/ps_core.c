@@ -30,6 +30,8 @@
 #include <stddef.h>
 #include <elf.h>
 #include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libproc_impl.h"
 #include "ps_core_common.h"
 #include "proc_service.h"
@@ -124,7 +126,11 @@ static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf,
       len = MIN(resid, mp->memsz - mapoff);
       off = mp->offset + mapoff;
 
-      if ((len = pread(fd, buf, len, off)) <= 0) {
+      if (fd == ph->core->core_fd && ph->core->core_map != NULL &&
+          (size_t)off + len <= ph->core->core_map_size) {
+         // copy straight out of the mapped core file, avoiding a syscall per read
+         memcpy(buf, ph->core->core_map + off, len);
+      } else if ((len = pread(fd, buf, len, off)) <= 0) {
          break;
       }
 
@@ -175,8 +181,16 @@ static bool core_get_lwp_regs(struct ps_prochandle* ph, lwpid_t lwp_id,
    return false;
 }
 
+static void linux_core_release(struct ps_prochandle* ph) {
+   if (ph->core != NULL && ph->core->core_map != NULL) {
+      munmap(ph->core->core_map, ph->core->core_map_size);
+      ph->core->core_map = NULL;
+   }
+   core_release(ph);
+}
+
 static ps_prochandle_ops core_ops = {
-   .release=  core_release,
+   .release=  linux_core_release,
    .p_pread=  core_read_data,
    .p_pwrite= core_write_data,
    .get_lwp_regs= core_get_lwp_regs
@@ -760,6 +774,21 @@ Pgrab_core(const char* exec_file, const char* core_file) {
     goto err;
   }
 
+  // map the core file so that reads of its segments need no pread() calls;
+  // if this fails we simply fall back to pread()
+  {
+    struct stat st;
+    if (fstat(ph->core->core_fd, &st) == 0 && st.st_size > 0) {
+      void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, ph->core->core_fd, 0);
+      if (base != MAP_FAILED) {
+        ph->core->core_map = (char*)base;
+        ph->core->core_map_size = (size_t)st.st_size;
+      } else {
+        print_debug("can't mmap core file, using pread\n");
+      }
+    }
+  }
+
   if ((ph->core->exec_fd = open(exec_file, O_RDONLY)) < 0) {
     print_debug("can't open executable file\n");
     goto err;
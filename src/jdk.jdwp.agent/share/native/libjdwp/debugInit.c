@@ -828,6 +828,7 @@ printUsage(void)
  "timeout=<timeout value>          for listen/attach in milliseconds n\n"
  "includevirtualthreads=y|n        List of all threads includes virtual threads as well as platform threads.\n"
  "                                                                   n\n"
+ "eventqueuesize=<bytes>           max size of queued events         51200\n"
  "mutf8=y|n                        output modified utf-8             n\n"
  "quiet=y|n                        control over terminal messages    n\n"));
 
@@ -979,6 +980,8 @@ parseOptions(char *options)
     gdata->includeVThreads = JNI_FALSE;
     gdata->rememberVThreadsWhenDisconnected = JNI_FALSE;
 
+    gdata->eventQueueSize = 0;
+
     /* Options being NULL will end up being an error. */
     if (options == NULL) {
         options = "";
@@ -1095,6 +1098,17 @@ parseOptions(char *options)
             // These two flags always set the same for now.
             gdata->rememberVThreadsWhenDisconnected = gdata->includeVThreads;
             current += strlen(current) + 1;
+        } else if (strcmp(buf, "eventqueuesize") == 0) {
+            /*LINTED*/
+            if (!get_tok(&str, current, (int)(end - current), ',')) {
+                goto syntax_error;
+            }
+            gdata->eventQueueSize = (jint)atol(current);
+            if (gdata->eventQueueSize <= 0) {
+                errmsg = "eventqueuesize must be a positive number of bytes";
+                goto bad_option_with_errmsg;
+            }
+            current += strlen(current) + 1;
         } else if (strcmp(buf, "launch") == 0) {
             /*LINTED*/
             if (!get_tok(&str, current, (int)(end - current), ',')) {
@@ -128,7 +128,7 @@ static jrawMonitorID blockCommandLoopLock;
 static jrawMonitorID vmDeathLock;
 static volatile jboolean commandLoopEnteredVmDeathLock = JNI_FALSE;
 
-static jint maxQueueSize = 50 * 1024; /* TO DO: Make this configurable */
+static jint maxQueueSize = 50 * 1024; /* See the eventqueuesize option */
 static jboolean holdEvents;
 static jint currentQueueSize = 0;
 static jint currentSessionID;
@@ -173,7 +173,8 @@ enqueueCommand(HelperCommand *command,
     command->next = NULL;
 
     debugMonitorEnter(commandQueueLock);
-    while (size + currentQueueSize > maxQueueSize) {
+    /* Always admit a command into an empty queue, even if maxQueueSize is smaller */
+    while (currentQueueSize > 0 && size + currentQueueSize > maxQueueSize) {
         debugMonitorWait(commandQueueLock);
     }
     log_debugee_location("enqueueCommand(): HelperCommand being processed", NULL, NULL, 0);
@@ -741,6 +742,9 @@ eventHelper_initialize(jbyte sessionID)
 
     currentSessionID = sessionID;
     holdEvents = JNI_FALSE;
+    if (gdata->eventQueueSize > 0) {
+        maxQueueSize = gdata->eventQueueSize;
+    }
     commandQueue.head = NULL;
     commandQueue.tail = NULL;
 
@@ -90,6 +90,7 @@ typedef struct {
     jboolean doerrorexit;
     jboolean modifiedUtf8;
     jboolean quiet;
+    jint     eventQueueSize; /* Max bytes of queued event helper commands, 0 for the default */
 
     /* Debug flags (bit mask) */
     int      debugflags;
@@ -463,24 +463,19 @@ JNIEXPORT jint JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_receive0
         if (msg->msg_flags & MSG_NOTIFICATION) {
             char *bufp = (char*)addr;
             union sctp_notification *snp;
-            jboolean allocated = JNI_FALSE;
+            /* A notification does not exceed the size of the union, so a
+             * stack buffer avoids allocating for every truncated one. */
+            union sctp_notification notifBuf;
 
             if (!(msg->msg_flags & MSG_EOR) && length < SCTP_NOTIFICATION_SIZE) {
-                char* newBuf;
+                char* newBuf = (char*) &notifBuf;
                 int rvSAVE = rv;
 
-                if ((newBuf = malloc(SCTP_NOTIFICATION_SIZE)) == NULL) {
-                    JNU_ThrowOutOfMemoryError(env, "Out of native heap space.");
-                    return -1;
-                }
-                allocated = JNI_TRUE;
-
                 memcpy(newBuf, addr, rv);
                 iov->iov_base = newBuf + rv;
                 iov->iov_len = SCTP_NOTIFICATION_SIZE - rv;
                 if ((rv = recvmsg(fd, msg, flags)) < 0) {
                     sctpHandleSocketError(env, errno);
-                    free(newBuf);
                     return 0;
                 }
                 bufp = newBuf;
@@ -493,16 +488,9 @@ JNIEXPORT jint JNICALL Java_sun_nio_ch_sctp_SctpChannelImpl_receive0
                 /* We have received a notification that is of interest
                    to the Java API. The appropriate notification will be
                    set in the result container. */
-                if (allocated == JNI_TRUE) {
-                    free(bufp);
-                }
                 return 0;
             }
 
-            if (allocated == JNI_TRUE) {
-                free(bufp);
-            }
-
             // set iov back to addr, and reset msg_controllen
             iov->iov_base = addr;
             iov->iov_len = length;
@@ -78,6 +78,7 @@ public:
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_remove_stale_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -479,6 +480,55 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+class G1RemoveOddRegionsFilter : public G1CardSet::CardRegionFilter {
+public:
+  bool is_stale(uint region_idx) override {
+    return (region_idx % 2) == 1;
+  }
+};
+
+void G1CardSetTest::cardset_remove_stale_test() {
+  const uint CardsPerRegion = 2048;
+
+  G1CardSetConfiguration config(28,
+                                0.9 /* BitmapCoarsenThreshold */,
+                                8,
+                                0.8 /* FullCardSetThreshold */,
+                                CardsPerRegion,
+                                0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+
+  // Use a different number of cards per region to get different containers,
+  // up to Howl containers.
+  const uint NumRegions = 8;
+  size_t expected_remaining = 0;
+  for (uint region_idx = 0; region_idx < NumRegions; region_idx++) {
+    uint const num_cards = 1u << region_idx;
+    for (uint i = 0; i < num_cards; i++) {
+      card_set.add_card(region_idx, (i * 7) % CardsPerRegion);
+    }
+    if ((region_idx % 2) == 0) {
+      expected_remaining += num_cards;
+    }
+  }
+  ASSERT_EQ(card_set.num_containers(), NumRegions);
+
+  G1RemoveOddRegionsFilter filter;
+  size_t num_removed = card_set.remove_stale_containers(&filter);
+  ASSERT_EQ(num_removed, NumRegions / 2);
+  ASSERT_EQ(card_set.num_containers(), NumRegions / 2);
+  ASSERT_EQ(card_set.occupied(), expected_remaining);
+
+  for (uint region_idx = 0; region_idx < NumRegions; region_idx++) {
+    ASSERT_EQ(card_set.contains_card(region_idx, 0), (region_idx % 2) == 0);
+  }
+
+  check_iteration(&card_set, expected_remaining);
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -486,3 +536,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, remove_stale_cardset_test) {
+  G1CardSetTest::cardset_remove_stale_test();
+}
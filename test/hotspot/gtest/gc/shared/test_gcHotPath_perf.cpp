@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+
+#include "unittest.hpp"
+
+// Repeatable multi-threaded microbenchmarks of GC hot-path data structures,
+// for spotting regressions without a full-application run. Each benchmark
+// also checks that no work got lost. Each run prints one line of the form
+//
+//   gc-hot-path-perf: name=<benchmark> threads=<n> ops=<count> ns=<elapsed>
+//
+// which is easy to pick out of the gtest output with a script.
+
+const uint _max_workers = 8;
+
+static WorkerThreads* _perf_workers = nullptr;
+
+static uint perf_num_workers() {
+  return MIN2(_max_workers, (uint)os::processor_count());
+}
+
+static WorkerThreads* perf_workers() {
+  if (_perf_workers == nullptr) {
+    WorkerThreads* wt = new WorkerThreads("GCHotPathPerf workers", perf_num_workers());
+    wt->initialize_workers();
+    wt->set_active_workers(perf_num_workers());
+    _perf_workers = wt;
+  }
+  return _perf_workers;
+}
+
+class VM_GCHotPathPerf : public VM_GTestExecuteAtSafepoint {
+  WorkerTask* _task;
+  uint _nthreads;
+
+public:
+  VM_GCHotPathPerf(WorkerTask* task, uint nthreads) : _task(task), _nthreads(nthreads) {}
+
+  void doit() {
+    perf_workers()->run_task(_task, _nthreads);
+  }
+};
+
+static void run_perf_task(const char* name, WorkerTask* task, uint nthreads, size_t ops) {
+  VM_GCHotPathPerf op(task, nthreads);
+  Ticks start;
+  Tickspan elapsed;
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    start = Ticks::now();
+    VMThread::execute(&op);
+    elapsed = Ticks::now() - start;
+  }
+  tty->print_cr("gc-hot-path-perf: name=%s threads=%u ops=" SIZE_FORMAT " ns=" JLONG_FORMAT,
+                name, nthreads, ops, (jlong)elapsed.nanoseconds());
+}
+
+// Every worker fills its own queue, then drains it with pop_local and
+// finishes by stealing from the others until all tasks are consumed.
+typedef GenericTaskQueue<uintptr_t, mtGC> PerfTaskQueue;
+typedef GenericTaskQueueSet<PerfTaskQueue, mtGC> PerfTaskQueueSet;
+
+class TaskQueuePerfTask : public WorkerTask {
+  PerfTaskQueueSet* _queues;
+  const size_t _tasks_per_worker;
+  volatile size_t _remaining;
+  volatile size_t _sum;
+
+public:
+  TaskQueuePerfTask(PerfTaskQueueSet* queues, size_t tasks_per_worker, uint nthreads) :
+    WorkerTask("TaskQueuePerfTask"),
+    _queues(queues),
+    _tasks_per_worker(tasks_per_worker),
+    _remaining(tasks_per_worker * nthreads),
+    _sum(0) {}
+
+  // Sum of all consumed tasks.
+  size_t sum() const { return Atomic::load(&_sum); }
+
+  virtual void work(uint worker_id) {
+    PerfTaskQueue* q = _queues->queue(worker_id);
+    for (size_t i = 0; i < _tasks_per_worker; i++) {
+      guarantee(q->push((uintptr_t)i + 1), "queue overflow");
+    }
+    size_t consumed = 0;
+    size_t sum = 0;
+    uintptr_t t;
+    while (Atomic::load(&_remaining) > 0) {
+      while (q->pop_local(t)) {
+        consumed++;
+        sum += t;
+      }
+      if (consumed > 0) {
+        Atomic::sub(&_remaining, consumed);
+        consumed = 0;
+      }
+      if (_queues->steal(worker_id, t)) {
+        Atomic::dec(&_remaining);
+        sum += t;
+      }
+    }
+    Atomic::add(&_sum, sum);
+  }
+};
+
+static void run_taskqueue_perf(uint nthreads) {
+  const size_t tasks_per_worker = TASKQUEUE_SIZE / 2;
+  PerfTaskQueueSet queues(nthreads);
+  for (uint i = 0; i < nthreads; i++) {
+    queues.register_queue(i, new PerfTaskQueue());
+  }
+  TaskQueuePerfTask task(&queues, tasks_per_worker, nthreads);
+  run_perf_task("taskqueue_push_pop_steal", &task, nthreads, tasks_per_worker * nthreads);
+  // Every worker pushed 1..tasks_per_worker, each must be consumed exactly once.
+  EXPECT_EQ(nthreads * (tasks_per_worker * (tasks_per_worker + 1) / 2), task.sum());
+  for (uint i = 0; i < nthreads; i++) {
+    EXPECT_TRUE(queues.queue(i)->is_empty());
+    delete queues.queue(i);
+  }
+}
+
+// Every worker repeatedly allocates a batch of entries one at a time,
+// as JNI handle creation does, and releases them again.
+class OopStoragePerfTask : public WorkerTask {
+  OopStorage* _storage;
+
+public:
+  static const size_t batch_size = 1000;
+  static const size_t rounds = 100;
+
+  OopStoragePerfTask(OopStorage* storage) :
+    WorkerTask("OopStoragePerfTask"), _storage(storage) {}
+
+  virtual void work(uint worker_id) {
+    oop* entries[batch_size];
+    for (size_t r = 0; r < rounds; r++) {
+      for (size_t i = 0; i < batch_size; i++) {
+        entries[i] = _storage->allocate();
+        guarantee(entries[i] != nullptr, "allocation failed");
+      }
+      for (size_t i = 0; i < batch_size; i++) {
+        _storage->release(entries[i]);
+      }
+    }
+  }
+};
+
+static void run_oopstorage_perf(uint nthreads) {
+  OopStorage* storage = OopStorage::create("GCHotPathPerf storage", mtGC);
+  OopStoragePerfTask task(storage);
+  run_perf_task("oopstorage_allocate_release", &task, nthreads,
+                OopStoragePerfTask::batch_size * OopStoragePerfTask::rounds * nthreads);
+  EXPECT_EQ(0u, storage->allocation_count());
+  delete storage;
+}
+
+TEST_VM(GCHotPathPerf, taskqueue) {
+  for (uint n = 1; n <= perf_num_workers(); n *= 2) {
+    run_taskqueue_perf(n);
+  }
+}
+
+TEST_VM(GCHotPathPerf, oopstorage) {
+  for (uint n = 1; n <= perf_num_workers(); n *= 2) {
+    run_oopstorage_perf(n);
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "unittest.hpp"
+
+// A small queue, so that a moderate number of tasks overflows into several
+// stealable chunks.
+typedef OverflowTaskQueue<uintptr_t, mtGC, 64> TestOverflowQueue;
+typedef GenericTaskQueueSet<TestOverflowQueue, mtGC> TestOverflowQueueSet;
+
+static const uintptr_t num_tasks = 4000;
+
+static void record_task(bool* seen, uintptr_t t) {
+  ASSERT_GE(t, 1u);
+  ASSERT_LE(t, num_tasks);
+  ASSERT_FALSE(seen[t]) << "task " << t << " consumed twice";
+  seen[t] = true;
+}
+
+TEST_VM(TaskQueue, steal_overflow) {
+  TestOverflowQueue* owner = new TestOverflowQueue();
+  TestOverflowQueue* thief = new TestOverflowQueue();
+  TestOverflowQueueSet queues(2);
+  queues.register_queue(0, owner);
+  queues.register_queue(1, thief);
+
+  for (uintptr_t i = 1; i <= num_tasks; i++) {
+    ASSERT_TRUE(owner->push(i));
+  }
+  ASSERT_EQ(owner->max_elems(), owner->size());
+  const uint stealable = owner->stealable_overflow_size();
+  ASSERT_GT(stealable, 0u) << "overflow should have been published";
+  ASSERT_EQ(owner->size() + stealable, queues.tasks());
+
+  bool* seen = NEW_C_HEAP_ARRAY(bool, num_tasks + 1, mtTest);
+  for (uintptr_t i = 0; i <= num_tasks; i++) {
+    seen[i] = false;
+  }
+
+  // The thief first empties the owner's task queue, then claims the
+  // published overflow chunks, processing what it got after each steal.
+  size_t stolen = 0;
+  uintptr_t t;
+  while (queues.steal(1, t)) {
+    record_task(seen, t);
+    stolen++;
+    while (thief->pop_overflow(t) || thief->pop_local(t)) {
+      record_task(seen, t);
+      stolen++;
+    }
+  }
+  EXPECT_EQ(owner->max_elems() + stealable, stolen);
+  EXPECT_EQ(0u, owner->stealable_overflow_size());
+  EXPECT_TRUE(thief->is_empty());
+  EXPECT_TRUE(thief->overflow_empty());
+
+  // The owner still has its private overflow.
+  EXPECT_FALSE(owner->overflow_empty());
+  while (owner->pop_overflow(t) || owner->pop_local(t)) {
+    record_task(seen, t);
+  }
+  EXPECT_TRUE(owner->is_empty());
+  EXPECT_TRUE(owner->overflow_empty());
+
+  for (uintptr_t i = 1; i <= num_tasks; i++) {
+    EXPECT_TRUE(seen[i]) << "task " << i << " lost";
+  }
+
+  FREE_C_HEAP_ARRAY(bool, seen);
+  delete owner;
+  delete thief;
+}
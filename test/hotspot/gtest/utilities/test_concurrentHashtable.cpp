@@ -410,6 +410,55 @@ static void cht_move_to(Thread* thr) {
   EXPECT_TRUE(cht_get_copy(to_cht, thr, stl3) == val3) << "Getting an inserted value should work.";
 }
 
+struct ChtMoveToTable {
+  Thread* _thr;
+  SimpleTestTable* _to;
+  ChtMoveToTable(Thread* thr, SimpleTestTable* to) : _thr(thr), _to(to) {}
+  void operator()(uintptr_t* val) {
+    SimpleTestLookup stl(*val);
+    EXPECT_TRUE(_to->insert(_thr, stl, *val)) << "Moving an unique value failed.";
+  }
+};
+
+static void cht_task_move(Thread* thr) {
+  uintptr_t val1 = 0x2;
+  uintptr_t val2 = 0xe0000002;
+  uintptr_t val3 = 0x3;
+  uintptr_t val4 = 0x4;
+  SimpleTestLookup stl1(val1), stl2(val2), stl3(val3), stl4(val4);
+  SimpleTestTable* from_cht = new SimpleTestTable();
+  EXPECT_TRUE(from_cht->insert(thr, stl1, val1)) << "Insert unique value failed.";
+  EXPECT_TRUE(from_cht->insert(thr, stl2, val2)) << "Insert unique value failed.";
+  EXPECT_TRUE(from_cht->insert(thr, stl3, val3)) << "Insert unique value failed.";
+
+  SimpleTestTable* to_cht = new SimpleTestTable();
+  SimpleTestTable::MoveTask mt(from_cht);
+  EXPECT_TRUE(mt.prepare(thr)) << "Move task prepare failed.";
+  EXPECT_FALSE(from_cht->insert(thr, stl4, val4)) << "Insert into a closed table succeeded.";
+  EXPECT_TRUE(cht_get_copy(from_cht, thr, stl1) == val1) << "Getting from a closed table should work.";
+
+  ChtMoveToTable move(thr, to_cht);
+  while (mt.do_task(thr, move)) {
+    mt.pause(thr);
+    mt.cont(thr);
+  }
+  mt.done(thr);
+
+  ChtCountScan scan_old;
+  EXPECT_TRUE(from_cht->try_scan(thr, scan_old)) << "Scanning table should work.";
+  EXPECT_EQ(scan_old._count, (size_t)0) << "All items should be moved";
+
+  ChtCountScan scan_new;
+  EXPECT_TRUE(to_cht->try_scan(thr, scan_new)) << "Scanning table should work.";
+  EXPECT_EQ(scan_new._count, (size_t)3) << "All items should be moved";
+  EXPECT_TRUE(cht_get_copy(to_cht, thr, stl1) == val1) << "Getting a moved value should work.";
+  EXPECT_TRUE(cht_get_copy(to_cht, thr, stl2) == val2) << "Getting a moved value should work.";
+  EXPECT_TRUE(cht_get_copy(to_cht, thr, stl3) == val3) << "Getting a moved value should work.";
+
+  delete from_cht;
+  delete to_cht;
+}
+
 static void cht_grow(Thread* thr) {
   uintptr_t val = 0x2;
   uintptr_t val2 = 0x22;
@@ -528,6 +577,10 @@ TEST_VM(ConcurrentHashTable, basic_move_to) {
   nomt_test_doer(cht_move_to);
 }
 
+TEST_VM(ConcurrentHashTable, task_move) {
+  nomt_test_doer(cht_task_move);
+}
+
 TEST_VM(ConcurrentHashTable, basic_grow) {
   nomt_test_doer(cht_grow);
 }
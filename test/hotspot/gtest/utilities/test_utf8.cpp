@@ -103,3 +103,45 @@ TEST_VM(utf8, jbyte_length) {
   }
 
 }
+
+TEST_VM(utf8, ascii_fast_path) {
+  // Place a single non-ASCII character at every position around the
+  // word boundaries of the ASCII fast paths and compare with the
+  // per-character encoding.
+  for (int len = 1; len < 24; len++) {
+    for (int pos = 0; pos < len; pos++) {
+      jchar chars[24];
+      jbyte bytes[24];
+      for (int i = 0; i < len; i++) {
+        chars[i] = (jchar) ('a' + i);
+        bytes[i] = (jbyte) ('a' + i);
+      }
+      chars[pos] = 0x0800;
+      bytes[pos] = (jbyte) 0xE9;
+
+      char res[80];
+      UNICODE::as_utf8(chars, len, res, sizeof(res));
+      ASSERT_EQ(UNICODE::utf8_length(chars, len), len + 2);
+      ASSERT_EQ(strlen(res), (size_t) (len + 2));
+      ASSERT_EQ((u_char) res[pos], 0xE0);
+
+      bool is_latin1;
+      bool has_multibyte;
+      ASSERT_EQ(UTF8::unicode_length(res, (int) strlen(res), is_latin1, has_multibyte), len);
+      ASSERT_FALSE(is_latin1);
+      ASSERT_TRUE(has_multibyte);
+      jchar back[24];
+      UTF8::convert_to_unicode(res, back, len);
+      ASSERT_EQ(memcmp(back, chars, len * sizeof(jchar)), 0);
+
+      UNICODE::as_utf8(bytes, len, res, sizeof(res));
+      ASSERT_EQ(UNICODE::utf8_length(bytes, len), len + 1);
+      ASSERT_EQ(strlen(res), (size_t) (len + 1));
+      ASSERT_EQ(UTF8::unicode_length(res, (int) strlen(res), is_latin1, has_multibyte), len);
+      ASSERT_TRUE(is_latin1);
+      jbyte back_bytes[24];
+      UTF8::convert_to_unicode(res, back_bytes, len);
+      ASSERT_EQ(memcmp(back_bytes, bytes, len), 0);
+    }
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary Check that int and long reductions with two element vectors are
+ *          vectorized when the reduction is moved out of the loop.
+ * @requires vm.compiler2.enabled
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestTwoElementReductions
+ */
+
+public class TestTwoElementReductions {
+    private static final int SIZE = 1024;
+
+    private static int[] ints = new int[SIZE];
+    private static long[] longs = new long[SIZE];
+
+    static {
+        for (int i = 0; i < SIZE; i++) {
+            ints[i] = i;
+            longs[i] = i * 3L;
+        }
+    }
+
+    public static void main(String[] args) {
+        // Two ints per 8 byte vector and two longs per 16 byte vector.
+        TestFramework.runWithFlags("-XX:MaxVectorSize=8", "-XX:+SuperWordReductions");
+        TestFramework.runWithFlags("-XX:MaxVectorSize=16", "-XX:+SuperWordReductions");
+    }
+
+    @Test
+    @IR(applyIf = {"MaxVectorSize", "8"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        counts = {IRNode.LOAD_VECTOR_I, IRNode.VECTOR_SIZE_2, "> 0",
+                  IRNode.ADD_VI, IRNode.VECTOR_SIZE_2, "> 0",
+                  IRNode.ADD_REDUCTION_VI, "> 0"})
+    static int sumInts(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumInts")
+    static void runSumInts() {
+        Asserts.assertEQ(sumInts(ints), SIZE * (SIZE - 1) / 2);
+    }
+
+    @Test
+    @IR(applyIf = {"MaxVectorSize", "16"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"},
+        counts = {IRNode.LOAD_VECTOR_L, IRNode.VECTOR_SIZE_2, "> 0",
+                  IRNode.ADD_VL, IRNode.VECTOR_SIZE_2, "> 0",
+                  IRNode.ADD_REDUCTION_VL, "> 0"})
+    static long sumLongs(long[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumLongs")
+    static void runSumLongs() {
+        Asserts.assertEQ(sumLongs(longs), 3L * SIZE * (SIZE - 1) / 2);
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestG1UseEvacuationTimeFeedback
+ * @summary Check that G1UseEvacuationTimeFeedback is accepted as experimental flag
+ *          and that the correction of optional region predictions stays in bounds.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestG1UseEvacuationTimeFeedback
+ */
+
+import java.util.ArrayList;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestG1UseEvacuationTimeFeedback {
+
+    private static final Pattern RatioPattern =
+        Pattern.compile("Evacuation time so far: actual [0-9.]+ms predicted [0-9.]+ms ratio ([0-9.]+)");
+
+    private static OutputAnalyzer run(String feedback) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UseG1GC",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            feedback,
+            // A tiny pause time goal leaves most old candidate regions optional.
+            "-XX:MaxGCPauseMillis=1",
+            "-Xms64m",
+            "-Xmx64m",
+            "-Xlog:gc+ergo+cset=debug",
+            GCTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.reportDiagnosticSummary();
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The flag is experimental.
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC", "-XX:+G1UseEvacuationTimeFeedback", "-version").start());
+        output.shouldContain("must be enabled via -XX:+UnlockExperimentalVMOptions");
+        output.shouldNotHaveExitValue(0);
+
+        // Without the flag the predictions are never corrected.
+        run("-XX:-G1UseEvacuationTimeFeedback").shouldNotMatch(RatioPattern.pattern());
+
+        // With the flag any correction is clamped. Whether a mixed pause
+        // predicts enough time for a correction depends on the machine.
+        String stdout = run("-XX:+G1UseEvacuationTimeFeedback").getStdout();
+        Matcher m = RatioPattern.matcher(stdout);
+        int corrections = 0;
+        while (m.find()) {
+            double ratio = Double.parseDouble(m.group(1));
+            Asserts.assertGTE(ratio, 0.25, "Correction ratio below lower bound");
+            Asserts.assertLTE(ratio, 4.0, "Correction ratio above upper bound");
+            corrections++;
+        }
+        System.out.println("Corrections: " + corrections);
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        public static void main(String[] args) throws Exception {
+            // Fill old regions with mostly dead objects to get many candidates
+            // for mixed collections.
+            ArrayList<byte[]> live = new ArrayList<>();
+            for (int i = 0; i < 20_000; i++) {
+                live.add(new byte[1024]);
+            }
+            WB.fullGC();
+            for (int i = 0; i < live.size(); i++) {
+                if (i % 4 != 0) {
+                    live.set(i, null);
+                }
+            }
+            WB.g1RunConcurrentGC();
+            // The young collections after the concurrent cycle are mixed.
+            for (int i = 0; i < 8; i++) {
+                WB.youngGC();
+            }
+            System.out.println(live.size());
+        }
+    }
+}
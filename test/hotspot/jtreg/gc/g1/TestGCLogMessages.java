@@ -173,6 +173,8 @@ public class TestGCLogMessages {
         new LogMessageWithLevel("Merge Per-Thread State", Level.DEBUG),
         new LogMessageWithLevel("LAB Waste", Level.DEBUG),
         new LogMessageWithLevel("LAB Undo Waste", Level.DEBUG),
+        new LogMessageWithLevel("LAB Refills", Level.DEBUG),
+        new LogMessageWithLevel("Direct Allocations", Level.DEBUG),
         new LogMessageWithLevel("Clear Logged Cards", Level.DEBUG),
         new LogMessageWithLevel("Recalculate Used Memory", Level.DEBUG),
 
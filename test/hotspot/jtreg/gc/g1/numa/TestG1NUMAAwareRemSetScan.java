@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1.numa;
+
+/*
+ * @test TestG1NUMAAwareRemSetScan
+ * @summary Check that with G1NUMAAwareRemSetScan workers claim cards of regions
+ *          on their own NUMA node during Scan Heap Roots.
+ * @requires vm.gc.G1
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.numa.TestG1NUMAAwareRemSetScan
+ */
+
+import java.util.Arrays;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestG1NUMAAwareRemSetScan {
+
+    private static final String ClaimedChunks = "Claimed Chunks:";
+    private static final String NodeLocalChunks = "Node Local Chunks:";
+    private static final String SumSeparator = "Sum: ";
+
+    private static long sumOf(String output, String item) {
+        return Arrays.stream(output.split("\\R"))
+                     .filter(s -> s.contains(item) && s.contains(SumSeparator))
+                     .mapToLong(s -> Long.parseLong(s.substring(s.indexOf(SumSeparator) + SumSeparator.length(),
+                                                                s.indexOf(", Workers"))))
+                     .sum();
+    }
+
+    private static OutputAnalyzer run(boolean numaAwareScan) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-XX:+UseNUMA",
+            "-XX:+UnlockExperimentalVMOptions",
+            numaAwareScan ? "-XX:+G1NUMAAwareRemSetScan" : "-XX:-G1NUMAAwareRemSetScan",
+            "-Xmx64m",
+            "-Xlog:gc+phases=debug",
+            GCTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        System.out.println(output.getStdout());
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run(true);
+        String stdout = output.getStdout();
+
+        long claimed = sumOf(stdout, ClaimedChunks);
+        Asserts.assertGT(claimed, 0L, "Scan Heap Roots must have claimed chunks");
+
+        if (!stdout.contains(NodeLocalChunks)) {
+            // The work item is only reported when G1 NUMA support is active,
+            // which requires more than one NUMA node.
+            System.out.println("NUMA is not enabled on this machine, skipping locality check");
+            return;
+        }
+
+        long local = sumOf(stdout, NodeLocalChunks);
+        Asserts.assertLTE(local, claimed, "Node local chunks must be a subset of the claimed chunks");
+        Asserts.assertGT(local, 0L, "Workers must have scanned regions on their own node");
+
+        // The work item is reported with NUMA regardless of the setting.
+        output = run(false);
+        output.shouldContain(NodeLocalChunks);
+    }
+
+    static class GCTest {
+        // Old objects referencing young ones so that young collections have
+        // cards to scan in old regions.
+        static Object[][] holders = new Object[256][];
+
+        public static void main(String[] args) {
+            for (int i = 0; i < holders.length; i++) {
+                holders[i] = new Object[1024];
+            }
+            System.gc();
+
+            for (int round = 0; round < 200; round++) {
+                for (Object[] holder : holders) {
+                    holder[round % holder.length] = new byte[64];
+                }
+                // Churn to trigger young collections.
+                for (int i = 0; i < 1000; i++) {
+                    byte[] garbage = new byte[256];
+                }
+            }
+        }
+    }
+}
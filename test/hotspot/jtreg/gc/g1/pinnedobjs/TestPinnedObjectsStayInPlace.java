@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1.pinnedobjs;
+
+/*
+ * @test TestPinnedObjectsStayInPlace
+ * @summary Check that objects pinned with GetPrimitiveArrayCritical are neither
+ *          moved nor freed by young and full collections.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm/native
+ *    -Xbootclasspath/a:.
+ *    -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *    -XX:+UseG1GC -Xmx64m -XX:+VerifyAfterGC
+ *    -Xlog:gc
+ *    gc.g1.pinnedobjs.TestPinnedObjectsStayInPlace
+ */
+
+import jdk.test.lib.Asserts;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestPinnedObjectsStayInPlace {
+    static { System.loadLibrary("TestPinnedObjectsStayInPlace"); }
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int NumArrays = 100;
+    private static final int ArrayLength = 1000;
+
+    private static native long pin(int[] array);
+    private static native void unpin(int[] array, long address);
+    private static native long address(int[] array);
+
+    private static int[][] pinned = new int[NumArrays][];
+    private static long[] addresses = new long[NumArrays];
+
+    private static void allocateGarbage() {
+        for (int i = 0; i < 10000; i++) {
+            int[] garbage = new int[100];
+        }
+    }
+
+    private static void checkInPlace(String gc) {
+        for (int i = 0; i < NumArrays; i++) {
+            Asserts.assertEQ(address(pinned[i]), addresses[i], "Pinned array " + i + " moved during " + gc);
+            for (int j = 0; j < ArrayLength; j++) {
+                Asserts.assertEQ(pinned[i][j], i + j, "Pinned array " + i + " corrupted during " + gc);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        // Interleave the pinned arrays with garbage so that the regions they are
+        // in contain dead objects that would otherwise be compacted away.
+        for (int i = 0; i < NumArrays; i++) {
+            pinned[i] = new int[ArrayLength];
+            for (int j = 0; j < ArrayLength; j++) {
+                pinned[i][j] = i + j;
+            }
+            allocateGarbage();
+        }
+        for (int i = 0; i < NumArrays; i++) {
+            addresses[i] = pin(pinned[i]);
+            Asserts.assertNE(addresses[i], 0L, "Failed to pin array " + i);
+        }
+
+        WB.youngGC();
+        checkInPlace("young GC");
+        allocateGarbage();
+        WB.youngGC();
+        checkInPlace("second young GC");
+        WB.fullGC();
+        checkInPlace("full GC");
+
+        for (int i = 0; i < NumArrays; i++) {
+            unpin(pinned[i], addresses[i]);
+        }
+
+        // Once unpinned the arrays may move again, but must stay intact.
+        WB.youngGC();
+        WB.fullGC();
+        for (int i = 0; i < NumArrays; i++) {
+            for (int j = 0; j < ArrayLength; j++) {
+                Asserts.assertEQ(pinned[i][j], i + j, "Unpinned array " + i + " corrupted");
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Native support for TestPinnedObjectsStayInPlace test.
+ */
+
+#include "jni.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pins the array by keeping its critical section open until unpin() is called.
+// HotSpot collectors with region pinning allow garbage collections meanwhile.
+JNIEXPORT jlong JNICALL
+Java_gc_g1_pinnedobjs_TestPinnedObjectsStayInPlace_pin(JNIEnv* env, jclass cls, jintArray array) {
+    return (jlong)(*env)->GetPrimitiveArrayCritical(env, array, 0);
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_pinnedobjs_TestPinnedObjectsStayInPlace_unpin(JNIEnv* env, jclass cls, jintArray array, jlong address) {
+    (*env)->ReleasePrimitiveArrayCritical(env, array, (void*)address, 0);
+}
+
+// Returns the current address of the array elements.
+JNIEXPORT jlong JNICALL
+Java_gc_g1_pinnedobjs_TestPinnedObjectsStayInPlace_address(JNIEnv* env, jclass cls, jintArray array) {
+    void* address = (*env)->GetPrimitiveArrayCritical(env, array, 0);
+    (*env)->ReleasePrimitiveArrayCritical(env, array, address, 0);
+    return (jlong)address;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.stringdedup;
+
+/*
+ * @test TestStringDeduplicationThreads
+ * @summary Check that string deduplication with several threads deduplicates
+ *          all strings and that the per-thread statistics add up.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.stringdedup.TestStringDeduplicationThreads
+ */
+
+import java.lang.reflect.Field;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStringDeduplicationThreads {
+
+    private static final int NumStrings = 2000;
+    private static final int NumCopies = 4;
+    private static final String AllDeduplicated = "All strings deduplicated";
+
+    private static final Pattern ThreadPattern = Pattern.compile("Thread (\\d+) Process: (\\d+) inspected");
+    private static final Pattern TotalPattern = Pattern.compile("Total Process:");
+
+    private static long statistic(String[] lines, int from, String name) {
+        Pattern p = Pattern.compile(name + ":\\s+(\\d+)");
+        for (int i = from; i < lines.length; i++) {
+            Matcher m = p.matcher(lines[i]);
+            if (m.find()) {
+                return Long.parseLong(m.group(1));
+            }
+        }
+        throw new RuntimeException("Statistic " + name + " not found");
+    }
+
+    private static void run(int threads) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xmx64m",
+            "-XX:+UseStringDeduplication",
+            "-XX:StringDeduplicationAgeThreshold=1",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:StringDeduplicationThreads=" + threads,
+            "-Xlog:stringdedup*=debug",
+            "--add-opens=java.base/java.lang=ALL-UNNAMED",
+            DeduplicationTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain(AllDeduplicated);
+
+        String[] lines = output.getStdout().split("\\R");
+        int lastTotal = -1;
+        for (int i = 0; i < lines.length; i++) {
+            if (TotalPattern.matcher(lines[i]).find()) {
+                lastTotal = i;
+            }
+        }
+        Asserts.assertGTE(lastTotal, 0, "No total statistics logged");
+
+        long inspected = statistic(lines, lastTotal, "Inspected");
+        long known = statistic(lines, lastTotal, "Known");
+        long shared = statistic(lines, lastTotal, "Shared");
+        long created = statistic(lines, lastTotal, "New");
+        long deduplicated = statistic(lines, lastTotal, "Deduplicated");
+        System.out.println("Threads: " + threads + " Inspected: " + inspected + " Known: " + known +
+                           " Shared: " + shared + " New: " + created + " Deduplicated: " + deduplicated);
+
+        Asserts.assertLTE(known + shared + created, inspected, "Inspected strings must be classified at most once");
+        Asserts.assertLTE(deduplicated, inspected, "Cannot deduplicate more strings than inspected");
+        Asserts.assertGTE(deduplicated, (long)NumStrings * (NumCopies - 1), "All copies must have been deduplicated");
+
+        if (threads == 1) {
+            output.shouldNotMatch("Thread \\d+ Process:");
+            return;
+        }
+
+        // Each thread reports what it inspected before the statistics of its
+        // cycle are logged, so all reports up to the last totals must add up.
+        long sum = 0;
+        boolean[] seen = new boolean[threads];
+        for (int i = 0; i < lastTotal; i++) {
+            Matcher m = ThreadPattern.matcher(lines[i]);
+            if (m.find()) {
+                seen[Integer.parseInt(m.group(1))] = true;
+                sum += Long.parseLong(m.group(2));
+            }
+        }
+        Asserts.assertEQ(sum, inspected, "Per-thread inspected counts must add up to the total");
+        for (int i = 0; i < threads; i++) {
+            Asserts.assertTrue(seen[i], "Thread " + i + " did not report");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        run(1);
+        run(4);
+    }
+
+    static class DeduplicationTest {
+        private static Field valueField;
+
+        private static Object valueOf(String s) throws Exception {
+            return valueField.get(s);
+        }
+
+        private static boolean allDeduplicated(String[][] strings) throws Exception {
+            for (String[] copies : strings) {
+                Object value = valueOf(copies[0]);
+                for (String copy : copies) {
+                    if (valueOf(copy) != value) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        public static void main(String[] args) throws Exception {
+            valueField = String.class.getDeclaredField("value");
+            valueField.setAccessible(true);
+
+            String[][] strings = new String[NumStrings][NumCopies];
+            for (int i = 0; i < NumStrings; i++) {
+                char[] chars = ("Deduplication test string " + i).toCharArray();
+                for (int j = 0; j < NumCopies; j++) {
+                    strings[i][j] = new String(chars);
+                }
+            }
+
+            // Age the strings so that they become deduplication candidates,
+            // then give the deduplication threads time to process them.
+            long deadline = System.currentTimeMillis() + 60_000;
+            while (!allDeduplicated(strings)) {
+                if (System.currentTimeMillis() > deadline) {
+                    throw new RuntimeException("Strings were not deduplicated in time");
+                }
+                System.gc();
+                Thread.sleep(100);
+            }
+            System.out.println(AllDeduplicated);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Check that a class the boot loader failed to find is found after
+ *          JVMTI AddToBootstrapClassLoaderSearch appends a JAR file containing
+ *          it, with and without the BootLoaderMissingClassCacheSize cache.
+ * @requires vm.jvmti
+ * @library /test/lib
+ * @run main/othervm/native -agentlib:BootLoaderMissingClassCache
+ *      BootLoaderMissingClassCache
+ * @run main/othervm/native -agentlib:BootLoaderMissingClassCache
+ *      -XX:+UnlockExperimentalVMOptions -XX:BootLoaderMissingClassCacheSize=64
+ *      BootLoaderMissingClassCache
+ */
+
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.jar.JarEntry;
+import java.util.jar.JarOutputStream;
+
+import jdk.test.lib.Asserts;
+
+public class BootLoaderMissingClassCache {
+    private static final String TargetName = "BootLoaderMissingClassCacheTarget";
+
+    private static native int addToBootstrapClassLoaderSearch(String segment);
+
+    private static boolean bootLoaderFinds(String name) throws Exception {
+        try {
+            Class<?> c = Class.forName(name, false, null);
+            Asserts.assertNull(c.getClassLoader(), "Must be loaded by the boot loader");
+            return true;
+        } catch (ClassNotFoundException e) {
+            return false;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        System.loadLibrary("BootLoaderMissingClassCache");
+
+        // The target class is on the application class path only.
+        for (int i = 0; i < 3; i++) {
+            Asserts.assertFalse(bootLoaderFinds(TargetName), "Boot loader must not find " + TargetName);
+        }
+
+        // Put the target class into a JAR file and append it to the boot
+        // loader search path, which must invalidate the cached miss.
+        Path jar = Path.of("boot-append.jar");
+        String entry = TargetName + ".class";
+        try (InputStream in = BootLoaderMissingClassCache.class.getClassLoader().getResourceAsStream(entry);
+             OutputStream out = Files.newOutputStream(jar);
+             JarOutputStream jos = new JarOutputStream(out)) {
+            jos.putNextEntry(new JarEntry(entry));
+            in.transferTo(jos);
+            jos.closeEntry();
+        }
+        Asserts.assertEQ(addToBootstrapClassLoaderSearch(jar.toString()), 0,
+                         "AddToBootstrapClassLoaderSearch failed");
+
+        Asserts.assertTrue(bootLoaderFinds(TargetName), "Boot loader must find " + TargetName + " after the append");
+    }
+}
+
+class BootLoaderMissingClassCacheTarget {
+}
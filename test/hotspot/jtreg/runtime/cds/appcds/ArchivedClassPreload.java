@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that ArchivedClassPreloadThreads loads the archived boot
+ *          classes of a static archive on background threads.
+ * @requires vm.cds
+ * @library /test/lib /test/hotspot/jtreg/runtime/cds/appcds
+ * @run driver ArchivedClassPreload
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ArchivedClassPreload {
+
+    private static final String ArchiveName = "preload.jsa";
+    private static final Pattern StartPattern =
+        Pattern.compile("Preloading (\\d+) archived boot classes with (\\d+) threads");
+    private static final Pattern EndPattern =
+        Pattern.compile("Preloaded (\\d+) of (\\d+) archived boot classes");
+
+    private static OutputAnalyzer run(String appJar, int threads) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-cp", appJar,
+            "-XX:SharedArchiveFile=" + ArchiveName,
+            "-Xshare:on",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:ArchivedClassPreloadThreads=" + threads,
+            "-Xlog:cds",
+            App.class.getName());
+        output.reportDiagnosticSummary();
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // CDS does not accept class directories in the class path.
+        String appJar = JarBuilder.build("preload", "ArchivedClassPreload$App");
+        ProcessTools.executeTestJava("-cp", appJar, "-XX:SharedArchiveFile=" + ArchiveName, "-Xshare:dump", "-Xlog:cds")
+                    .shouldHaveExitValue(0);
+
+        // Without threads nothing is preloaded.
+        run(appJar, 0).shouldNotMatch(StartPattern.pattern());
+
+        OutputAnalyzer output = run(appJar, 2);
+        String stdout = output.getStdout();
+        Matcher start = StartPattern.matcher(stdout);
+        Asserts.assertTrue(start.find(), "Preloading did not start");
+        int classes = Integer.parseInt(start.group(1));
+        Asserts.assertGT(classes, 0, "No archived boot classes to preload");
+        Asserts.assertEQ(Integer.parseInt(start.group(2)), 2, "Unexpected number of preload threads");
+
+        Matcher end = EndPattern.matcher(stdout);
+        Asserts.assertTrue(end.find(), "Preloading did not finish");
+        Asserts.assertEQ(Integer.parseInt(end.group(2)), classes, "Preloaded a different list of classes");
+        Asserts.assertLTE(Integer.parseInt(end.group(1)), classes, "Preloaded more classes than archived");
+        Asserts.assertGT(Integer.parseInt(end.group(1)), 0, "No archived class was preloaded");
+    }
+
+    static class App {
+        public static void main(String[] args) throws Exception {
+            // The preload threads are hidden, so give them time to finish
+            // before the VM exits.
+            Thread.sleep(3000);
+            System.out.println("Done");
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check ArchiveMethodCounters: the invocation counts of the training
+ *          run are kept in the dynamic archive and used by the compilation policy.
+ * @requires vm.cds
+ * @requires vm.compiler1.enabled
+ * @library /test/lib /test/hotspot/jtreg/runtime/cds/appcds
+ * @build jdk.test.whitebox.WhiteBox ArchiveMethodCountersApp
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver TestArchiveMethodCounters
+ */
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestArchiveMethodCounters {
+
+    private static OutputAnalyzer exec(String appJar, String... args) throws Exception {
+        String[] common = {
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-cp", appJar,
+        };
+        String[] all = new String[common.length + args.length];
+        System.arraycopy(common, 0, all, 0, common.length);
+        System.arraycopy(args, 0, all, common.length, args.length);
+        OutputAnalyzer output = ProcessTools.executeTestJava(all);
+        output.reportDiagnosticSummary();
+        return output;
+    }
+
+    // Dumps an archive after a training run, then checks the compilation
+    // level reached by a few invocations when running with it.
+    private static void test(String appJar, boolean archiveCounters, String expected) throws Exception {
+        String archive = "method-counters-" + archiveCounters + ".jsa";
+        String app = ArchiveMethodCountersApp.class.getName();
+
+        // Only interpret during training so that all invocations are counted.
+        exec(appJar, "-Xint", "-XX:ArchiveClassesAtExit=" + archive,
+             archiveCounters ? "-XX:+ArchiveMethodCounters" : "-XX:-ArchiveMethodCounters",
+             app, "train")
+            .shouldHaveExitValue(0);
+
+        exec(appJar, "-XX:SharedArchiveFile=" + archive, "-Xshare:on", "-Xbatch", app, "run")
+            .shouldHaveExitValue(0)
+            .shouldMatch(expected);
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The flag is experimental.
+        ProcessTools.executeTestJava("-XX:+ArchiveMethodCounters", "-version")
+                    .shouldContain("must be enabled via -XX:+UnlockExperimentalVMOptions")
+                    .shouldNotHaveExitValue(0);
+        ProcessTools.executeTestJava("-XX:+UnlockExperimentalVMOptions", "-XX:+ArchiveMethodCounters", "-version")
+                    .shouldHaveExitValue(0);
+
+        String appJar = JarBuilder.build("method-counters", "ArchiveMethodCountersApp");
+
+        // Without the archived counters the few invocations stay below the
+        // Tier3 thresholds.
+        test(appJar, false, "compilation level: 0");
+        // With them the training run's counts pass the thresholds at the first
+        // invocation notification.
+        test(appJar, true, "compilation level: [1-4]");
+    }
+}
+
+class ArchiveMethodCountersApp {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    // Well above Tier3InvocationThreshold.
+    private static final int TrainingInvocations = 5000;
+    // More than one invocation notification, but fewer invocations than
+    // Tier3InvocationThreshold.
+    private static final int FewInvocations = 150;
+
+    static int counter;
+
+    static void hot() {
+        counter++;
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method hot = ArchiveMethodCountersApp.class.getDeclaredMethod("hot");
+        int invocations = args[0].equals("train") ? TrainingInvocations : FewInvocations;
+        for (int i = 0; i < invocations; i++) {
+            hot();
+        }
+        System.out.println("compilation level: " + WB.getMethodCompilationLevel(hot));
+    }
+}
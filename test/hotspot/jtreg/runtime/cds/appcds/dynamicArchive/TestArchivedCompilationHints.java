@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check UseArchivedCompilationHints: methods that had C2 code when the
+ *          dynamic archive was dumped are profiled without waiting for the
+ *          interpreter thresholds.
+ * @requires vm.cds
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib /test/hotspot/jtreg/runtime/cds/appcds
+ * @build jdk.test.whitebox.WhiteBox ArchivedCompilationHintsApp
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver TestArchivedCompilationHints
+ */
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestArchivedCompilationHints {
+
+    private static final String ArchiveName = "compilation-hints.jsa";
+
+    private static OutputAnalyzer exec(String appJar, String... args) throws Exception {
+        String[] common = {
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-cp", appJar,
+        };
+        String[] all = new String[common.length + args.length];
+        System.arraycopy(common, 0, all, 0, common.length);
+        System.arraycopy(args, 0, all, common.length, args.length);
+        OutputAnalyzer output = ProcessTools.executeTestJava(all);
+        output.reportDiagnosticSummary();
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The flag is experimental.
+        ProcessTools.executeTestJava("-XX:+UseArchivedCompilationHints", "-version")
+                    .shouldContain("must be enabled via -XX:+UnlockExperimentalVMOptions")
+                    .shouldNotHaveExitValue(0);
+        ProcessTools.executeTestJava("-XX:+UnlockExperimentalVMOptions", "-XX:+UseArchivedCompilationHints", "-version")
+                    .shouldHaveExitValue(0);
+
+        String appJar = JarBuilder.build("compilation-hints", "ArchivedCompilationHintsApp");
+        String app = ArchivedCompilationHintsApp.class.getName();
+
+        exec(appJar, "-XX:ArchiveClassesAtExit=" + ArchiveName, app, "dump")
+            .shouldHaveExitValue(0);
+
+        // Without the hints the few invocations stay below the Tier3 thresholds.
+        exec(appJar, "-XX:SharedArchiveFile=" + ArchiveName, "-Xshare:on", "-Xbatch",
+             "-XX:-UseArchivedCompilationHints", app, "run")
+            .shouldHaveExitValue(0)
+            .shouldContain("compilation level: 0");
+
+        // With the hints the first invocation notification compiles the method.
+        exec(appJar, "-XX:SharedArchiveFile=" + ArchiveName, "-Xshare:on", "-Xbatch",
+             "-XX:+UseArchivedCompilationHints", app, "run")
+            .shouldHaveExitValue(0)
+            .shouldNotContain("compilation level: 0");
+    }
+}
+
+class ArchivedCompilationHintsApp {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    // More than one invocation notification, but fewer invocations than
+    // Tier3InvocationThreshold.
+    private static final int FewInvocations = 150;
+
+    static int counter;
+
+    static void hot() {
+        counter++;
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method hot = ArchivedCompilationHintsApp.class.getDeclaredMethod("hot");
+        if (args[0].equals("dump")) {
+            // Have C2 code when the archive is dumped at exit.
+            if (!WB.enqueueMethodForCompilation(hot, 4 /* CompLevel_full_optimization */)) {
+                throw new RuntimeException("Could not enqueue hot() for C2");
+            }
+            while (WB.getMethodCompilationLevel(hot) != 4) {
+                Thread.sleep(10);
+            }
+        } else {
+            for (int i = 0; i < FewInvocations; i++) {
+                hot();
+            }
+            System.out.println("compilation level: " + WB.getMethodCompilationLevel(hot));
+        }
+    }
+}
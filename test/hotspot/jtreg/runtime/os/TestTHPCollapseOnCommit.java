@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that THPCollapseOnCommit backs the committed heap with
+ *          transparent huge pages, as reported by AnonHugePages in smaps.
+ * @requires os.family == "linux"
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver TestTHPCollapseOnCommit
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jtreg.SkippedException;
+
+public class TestTHPCollapseOnCommit {
+
+    private static final Pattern HeapPattern = Pattern.compile("Heap: .* base=(0x[0-9a-f]+) size=(\\d+)M");
+    private static final Pattern MappingPattern = Pattern.compile("^([0-9a-f]+)-([0-9a-f]+) .*");
+    private static final Pattern AnonHugePattern = Pattern.compile("^AnonHugePages:\\s+(\\d+) kB");
+
+    private static void checkPreconditions() throws Exception {
+        Path enabled = Path.of("/sys/kernel/mm/transparent_hugepage/enabled");
+        if (!Files.exists(enabled) || Files.readString(enabled).contains("[never]")) {
+            throw new SkippedException("Transparent huge pages are not available");
+        }
+        // MADV_COLLAPSE needs Linux 6.1.
+        String[] version = System.getProperty("os.version").split("[.-]");
+        int major = Integer.parseInt(version[0]);
+        int minor = Integer.parseInt(version[1]);
+        if (major < 6 || (major == 6 && minor < 1)) {
+            throw new SkippedException("MADV_COLLAPSE is not supported by kernel " + System.getProperty("os.version"));
+        }
+    }
+
+    // Sums AnonHugePages of all mappings in the given smaps dump that overlap [base, end).
+    private static long anonHugePagesKB(String smaps, long base, long end) {
+        long sum = 0;
+        boolean inRange = false;
+        for (String line : smaps.split("\\R")) {
+            Matcher m = MappingPattern.matcher(line);
+            if (m.matches()) {
+                long start = Long.parseUnsignedLong(m.group(1), 16);
+                long stop = Long.parseUnsignedLong(m.group(2), 16);
+                inRange = start < end && stop > base;
+                continue;
+            }
+            m = AnonHugePattern.matcher(line);
+            if (inRange && m.matches()) {
+                sum += Long.parseLong(m.group(1));
+            }
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        checkPreconditions();
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseSerialGC",
+            "-Xms128m",
+            "-Xmx128m",
+            "-XX:+UseTransparentHugePages",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+THPCollapseOnCommit",
+            "-Xlog:pagesize",
+            PrintSmaps.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.reportDiagnosticSummary();
+        String stdout = output.getStdout();
+
+        Matcher m = HeapPattern.matcher(stdout);
+        Asserts.assertTrue(m.find(), "Heap reservation not logged");
+        long base = Long.parseUnsignedLong(m.group(1).substring(2), 16);
+        long sizeKB = Long.parseLong(m.group(2)) * 1024;
+
+        long hugeKB = anonHugePagesKB(stdout, base, base + sizeKB * 1024);
+        System.out.println("AnonHugePages for heap: " + hugeKB + " kB of " + sizeKB + " kB");
+        // The whole heap is committed at startup, so it must have been
+        // populated and collapsed into huge pages.
+        Asserts.assertGT(hugeKB, 0L, "Committed heap is not backed by huge pages");
+    }
+
+    static class PrintSmaps {
+        public static void main(String[] args) throws Exception {
+            System.out.println(Files.readString(Path.of("/proc/self/smaps")));
+        }
+    }
+}
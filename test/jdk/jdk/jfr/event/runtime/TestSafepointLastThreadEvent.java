@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Test that jdk.SafepointLastThread names the thread that was waited
+ *          for and the Java method it stopped in
+ * @requires vm.hasJFR
+ * @modules jdk.jfr
+ * @run main/othervm -Xint TestSafepointLastThreadEvent
+ */
+
+import java.nio.file.Path;
+import java.time.Duration;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedMethod;
+import jdk.jfr.consumer.RecordedThread;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestSafepointLastThreadEvent {
+    private static final String EVENT_NAME = "jdk.SafepointLastThread";
+    private static final String SPINNER_NAME = "Spinner";
+
+    private static volatile boolean done;
+    private static volatile long counter;
+
+    // Runs without calls, so the spinner can only stop in this method.
+    private static void spin() {
+        while (!done) {
+            counter++;
+        }
+    }
+
+    public static void main(String[] args) throws Throwable {
+        Thread spinner = new Thread(TestSafepointLastThreadEvent::spin, SPINNER_NAME);
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME).withThreshold(Duration.ofMillis(0));
+            recording.start();
+            spinner.start();
+            // Each System.gc() stops the world, and the running spinner has to
+            // be waited for.
+            for (int i = 0; i < 50; i++) {
+                System.gc();
+            }
+            done = true;
+            spinner.join();
+            recording.stop();
+
+            Path file = Path.of("safepoint-last-thread.jfr");
+            recording.dump(file);
+            List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+
+            boolean found = false;
+            for (RecordedEvent event : events) {
+                if (!event.getEventType().getName().equals(EVENT_NAME)) {
+                    continue;
+                }
+                System.out.println(event);
+                if (event.getLong("safepointId") <= 0) {
+                    throw new RuntimeException("Missing safepoint id: " + event);
+                }
+                RecordedThread thread = event.getValue("lastThread");
+                if (thread == null || !SPINNER_NAME.equals(thread.getJavaName())) {
+                    continue;
+                }
+                RecordedMethod method = event.getValue("method");
+                if (method == null || !method.getName().equals("spin")) {
+                    throw new RuntimeException("Spinner must have stopped in spin(): " + event);
+                }
+                if (event.getInt("bci") < 0) {
+                    throw new RuntimeException("Missing bci: " + event);
+                }
+                found = true;
+            }
+            if (!found) {
+                throw new RuntimeException("No " + EVENT_NAME + " event for thread " + SPINNER_NAME);
+            }
+        }
+    }
+}
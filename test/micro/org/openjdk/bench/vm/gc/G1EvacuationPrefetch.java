@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Measures G1 young collection copy throughput on a pointer-heavy object
+ * graph whose nodes are linked in random order, so that evacuation suffers
+ * from cache misses when following references. Compare results with
+ * different values of -XX:G1EvacuationPrefetchDistance. System.gc() is
+ * turned into a concurrent start young collection which evacuates the graph.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Benchmark)
+@Warmup(iterations = 3)
+@Measurement(iterations = 5)
+public class G1EvacuationPrefetch {
+
+    static class Node {
+        Node left;
+        Node right;
+        Node next;
+        long payload;
+    }
+
+    @Param({"1000000"})
+    public int nodes;
+
+    private Node[] live;
+
+    @Setup(Level.Invocation)
+    public void setup() {
+        Random random = new Random(42);
+        live = new Node[nodes];
+        for (int i = 0; i < nodes; i++) {
+            live[i] = new Node();
+        }
+        for (int i = 0; i < nodes; i++) {
+            Node n = live[i];
+            n.left = live[random.nextInt(nodes)];
+            n.right = live[random.nextInt(nodes)];
+            n.next = live[random.nextInt(nodes)];
+        }
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx2g", "-Xmn1g", "-XX:+ExplicitGCInvokesConcurrent",
+                                      "-XX:+UnlockExperimentalVMOptions",
+                                      "-XX:G1EvacuationPrefetchDistance=0"})
+    public void noPrefetch() {
+        System.gc();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx2g", "-Xmn1g", "-XX:+ExplicitGCInvokesConcurrent",
+                                      "-XX:+UnlockExperimentalVMOptions",
+                                      "-XX:G1EvacuationPrefetchDistance=4"})
+    public void prefetchDistance4() {
+        System.gc();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx2g", "-Xmn1g", "-XX:+ExplicitGCInvokesConcurrent",
+                                      "-XX:+UnlockExperimentalVMOptions",
+                                      "-XX:G1EvacuationPrefetchDistance=8"})
+    public void prefetchDistance8() {
+        System.gc();
+    }
+}
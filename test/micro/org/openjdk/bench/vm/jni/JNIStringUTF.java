@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.jni;
+
+import java.util.concurrent.TimeUnit;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Measures the modified UTF-8 conversions done by the JNI string functions
+ * for compact (Latin-1) and UTF-16 strings of different lengths.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Fork(3)
+public class JNIStringUTF {
+
+    static {
+        System.loadLibrary("JNIStringUTF");
+    }
+
+    private static native int getStringUTFChars(String str);
+    private static native int getStringUTFRegion(String str);
+    private static native String newStringUTF(String str);
+
+    @Param({"16", "256"})
+    public int length;
+
+    @Param({"ascii", "utf16"})
+    public String coder;
+
+    private String str;
+
+    @Setup
+    public void setup() {
+        StringBuilder sb = new StringBuilder(length);
+        for (int i = 0; i < length; i++) {
+            sb.append((char) ('a' + i % 26));
+        }
+        if (coder.equals("utf16")) {
+            // A single non-Latin-1 character at the end keeps the
+            // string UTF-16 encoded while leaving a long ASCII run
+            sb.setCharAt(length - 1, '\u20ac');
+        }
+        str = sb.toString();
+    }
+
+    @Benchmark
+    public int getStringUTFChars() {
+        return getStringUTFChars(str);
+    }
+
+    @Benchmark
+    public int getStringUTFRegion() {
+        return getStringUTFRegion(str);
+    }
+
+    @Benchmark
+    public String newStringUTF() {
+        return newStringUTF(str);
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <jni.h>
+#include <string.h>
+
+JNIEXPORT jint JNICALL Java_org_openjdk_bench_vm_jni_JNIStringUTF_getStringUTFChars(JNIEnv *env, jclass cls, jstring str) {
+    const char *chars = (*env)->GetStringUTFChars(env, str, NULL);
+    jint len = (jint)strlen(chars);
+    (*env)->ReleaseStringUTFChars(env, str, chars);
+    return len;
+}
+
+JNIEXPORT jint JNICALL Java_org_openjdk_bench_vm_jni_JNIStringUTF_getStringUTFRegion(JNIEnv *env, jclass cls, jstring str) {
+    char tmp[1024]; /* large enough for 256 three-byte characters */
+    jsize len = (*env)->GetStringLength(env, str);
+    (*env)->GetStringUTFRegion(env, str, 0, len, tmp);
+    return (jint)strlen(tmp);
+}
+
+JNIEXPORT jstring JNICALL Java_org_openjdk_bench_vm_jni_JNIStringUTF_newStringUTF(JNIEnv *env, jclass cls, jstring str) {
+    const char *chars = (*env)->GetStringUTFChars(env, str, NULL);
+    jstring result = (*env)->NewStringUTF(env, chars);
+    (*env)->ReleaseStringUTFChars(env, str, chars);
+    return result;
+}